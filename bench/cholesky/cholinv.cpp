@@ -1,6 +1,7 @@
 /* Author: Edward Hutter */
 
 #include "../../src/alg/cholesky/cholinv/cholinv.h"
+#include "../../src/alg/matmult/cannon25d/cannon25d.h"
 #include "../../test/cholesky/validate.h"
 
 using namespace std;
@@ -31,6 +32,10 @@ int main(int argc, char** argv){
   using cholesky_type = typename cholesky::cholinv<policy::cholinv::Serialize,policy::cholinv::SaveIntermediates,policy::cholinv::NoReplication>;
 //  using cholesky_type = typename cholesky::cholinv<policy::cholinv::Serialize,policy::cholinv::SaveIntermediates,policy::cholinv::ReplicationCommComp>;
 //  using cholesky_type = typename cholesky::cholinv<policy::cholinv::Serialize,policy::cholinv::SaveIntermediates,policy::cholinv::ReplicateComp>;
+//  using cholesky_type = typename cholesky::cholinv<policy::cholinv::Serialize,policy::cholinv::SaveIntermediates,policy::cholinv::DistributeComp>;
+//  using cholesky_type = typename cholesky::cholinv<policy::cholinv::Serialize,policy::cholinv::SaveIntermediates,policy::cholinv::NodeShared>;
+//  using cholesky_type = typename cholesky::cholinv<policy::cholinv::Serialize,policy::cholinv::SaveIntermediates,policy::cholinv::NoReplication,matmult::cannon25d>;
+//  using cholesky_type = typename cholesky::cholinv<policy::cholinv::Serialize,policy::cholinv::SaveIntermediates,policy::cholinv::NoReplication,matmult::summa,policy::cholinv::Lookahead>;
   size_t process_cube_dim = std::nearbyint(std::ceil(pow(size,1./3.)));
   size_t rep_factor = process_cube_dim/rep_div;
   T residual_error_local,residual_error_global; auto mpi_dtype = mpi_type<T>::type;
@@ -40,6 +45,8 @@ int main(int argc, char** argv){
     A.distribute_symmetric(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c,true);
     // Generate algorithmic structure via instantiating packs
     cholesky_type::info<T,U> pack(complete_inv,split,bcMultiplier,dir);
+    // Walk the recursion and create its intermediates once, so that every factorization below only replays them
+    cholesky_type::plan(A, pack, SquareTopo);
     // Warm cache and BLAS/LAPACK/MPI routines
     cholesky_type::factor(A, pack, SquareTopo);
 
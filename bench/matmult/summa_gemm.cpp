@@ -6,7 +6,7 @@ using namespace std;
 
 int main(int argc, char** argv){
   using T = double; using U = int64_t;
-  using MatrixTypeR = matrix<T,U,rect>;
+  using MatrixTypeR = matrix<T,U,rect,OffloadEachGemm,HugePageAllocator>;	// the operands are large enough to span huge pages
   using MatrixTypeLT = matrix<T,U,lowertri>;
   using MatrixTypeUT = matrix<T,U,uppertri>;
 
@@ -23,12 +23,38 @@ int main(int argc, char** argv){
   size_t layout        = atoi(argv[5]);// arranges sub-communicator layout
   size_t num_chunks    = atoi(argv[6]);
   size_t numIterations = atoi(argv[7]);
+  size_t pipeline_depth = (argc>8 ? atoi(argv[8]) : 0);// number of K-panels kept in flight beyond the one being multiplied (0 disables pipelining)
+  size_t use_plan       = (argc>9 ? atoi(argv[9]) : 0);// repeat the multiplication through a summa::plan
+  size_t use_cuboid     = (argc>10 ? atoi(argv[10]) : 0);// multiply on a pm x pn x pk grid fitted to M,N,K (see topo::cuboid) instead of the square grid
 
   auto mpi_dtype = mpi_type<T>::type;
   U pGridCubeDim = std::nearbyint(std::ceil(pow(size,1./3.)));
   pGridDimensionC = pGridCubeDim/pGridDimensionC;
-  {
-    auto SquareTopo = topo::square(MPI_COMM_WORLD,pGridDimensionC,layout,num_chunks);
+  if (use_cuboid){
+    auto grid = topo::cuboid::fit(globalMatrixSizeM,globalMatrixSizeN,globalMatrixSizeK,size);
+    topo::cuboid CuboidTopo(MPI_COMM_WORLD,grid[0],grid[1],grid[2]);
+    auto pm = CuboidTopo.pm; auto pn = CuboidTopo.pn; auto pk = CuboidTopo.pk;
+    MatrixTypeR matA(globalMatrixSizeK,globalMatrixSizeM,pn*pk,pm);
+    MatrixTypeR matB(globalMatrixSizeN,globalMatrixSizeK,pn,pm*pk);
+    MatrixTypeR matC(globalMatrixSizeN,globalMatrixSizeM,pn,pm);
+    blas::ArgPack_gemm<T> blasArgs(blas::Order::AblasColumnMajor, blas::Transpose::AblasNoTrans, blas::Transpose::AblasNoTrans, 1., 0.);
+    matA.distribute_random(CuboidTopo.x*pk+CuboidTopo.z, CuboidTopo.y, pn*pk, pm, rank);
+    matB.distribute_random(CuboidTopo.x, CuboidTopo.y*pk+CuboidTopo.z, pn, pm*pk, rank*(-1));
+    matC.distribute_random(CuboidTopo.x, CuboidTopo.y, pn, pm, rank/pk*(-1));
+    for (size_t i=0; i<numIterations; i++){
+      MPI_Barrier(MPI_COMM_WORLD);		// make sure each process starts together
+#ifdef CRITTER
+      critter::start();
+#endif
+      matmult::summa::invoke(matA, matB, matC, CuboidTopo, blasArgs);
+#ifdef CRITTER
+      critter::stop();
+      critter::record();
+#endif
+    }
+  }
+  else{
+    auto SquareTopo = topo::square(MPI_COMM_WORLD,pGridDimensionC,layout,num_chunks,pipeline_depth);
     MatrixTypeR matA(globalMatrixSizeK,globalMatrixSizeM,SquareTopo.d,SquareTopo.d);
     MatrixTypeR matB(globalMatrixSizeN,globalMatrixSizeK,SquareTopo.d,SquareTopo.d);
     MatrixTypeR matC(globalMatrixSizeN,globalMatrixSizeM,SquareTopo.d,SquareTopo.d);
@@ -38,17 +64,24 @@ int main(int argc, char** argv){
     matC.distribute_random(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c*(-1));
 
     // Loop for getting a good range of results.
-    for (size_t i=0; i<numIterations; i++){
-      MPI_Barrier(MPI_COMM_WORLD);		// make sure each process starts together
+    auto iterate = [&](auto&& multiply){
+      for (size_t i=0; i<numIterations; i++){
+        MPI_Barrier(MPI_COMM_WORLD);		// make sure each process starts together
 #ifdef CRITTER
-      critter::start();
+        critter::start();
 #endif
-      matmult::summa::invoke(matA, matB, matC, SquareTopo, blasArgs);
+        multiply();
 #ifdef CRITTER
-      critter::stop();
-      critter::record();
+        critter::stop();
+        critter::record();
 #endif
+      }
+    };
+    if (use_plan){
+      auto plan = matmult::summa::make_plan(matA, matB, matC, SquareTopo, blasArgs);
+      iterate([&](){ plan.execute(); });
     }
+    else{ iterate([&](){ matmult::summa::invoke(matA, matB, matC, SquareTopo, blasArgs); }); }
   }
   MPI_Finalize();
   return 0;
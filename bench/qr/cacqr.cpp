@@ -25,6 +25,7 @@ int main(int argc, char** argv){
   size_t num_iter   = atoi(argv[12]);// number of simulations of the algorithm for performance testing
 
   using qr_type = qr::cacqr<qr::policy::cacqr::Serialize,qr::policy::cacqr::SaveIntermediates>;
+  //using qr_type = qr::cacqr<qr::policy::cacqr::Serialize,qr::policy::cacqr::SaveIntermediates,qr::policy::cacqr::MixedPrecision>;
   {
     T residual_error,orthogonality_error; auto mpi_dtype = mpi_type<T>::type;
 
@@ -8,8 +8,8 @@ CCMPI=
 INCLUDES=
 #DEFS=-DMKL -DCRITTER -DALGORITHMIC_SYMBOLS
 DEFS=
-#CFLAGS=-g -Wall -O3 -std=c++14 -mkl=parallel -xMIC-AVX512 ${DEFS} ${INCLUDES}
-CFLAGS=${DEFS} ${INCLUDES} -O3 -std=c++14 -fpermissive
+#CFLAGS=-g -Wall -O3 -std=c++14 -qopenmp -mkl=parallel -xMIC-AVX512 ${DEFS} ${INCLUDES}
+CFLAGS=${DEFS} ${INCLUDES} -O3 -std=c++14 -fopenmp -fpermissive
 #LIB_PATH=-L$(critter_dir)/lib
 LIB_PATH=
 #LIBS=-lcritter
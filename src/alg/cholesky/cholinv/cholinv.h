@@ -10,19 +10,32 @@
 namespace cholesky{
 template<class SerializePolicy     = policy::cholinv::Serialize,
          class IntermediatesPolicy = policy::cholinv::SaveIntermediates,
-         class BaseCasePolicy      = policy::cholinv::NoReplication>
-class cholinv : public SerializePolicy, public IntermediatesPolicy, public BaseCasePolicy{
+         class BaseCasePolicy      = policy::cholinv::NoReplication,
+         class MultiplyPolicy      = matmult::summa,
+         class OverlapPolicy       = policy::cholinv::NoLookahead>
+class cholinv : public SerializePolicy, public IntermediatesPolicy, public BaseCasePolicy, public OverlapPolicy{
 public:
   template<typename ScalarT, typename DimensionT>
   class info{
   public:
     using ScalarType = ScalarT;
     using DimensionType = DimensionT;
-    using alg_type = cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>;
-    using SP = SerializePolicy; using IP = IntermediatesPolicy; using BP = BaseCasePolicy;
+    using alg_type = cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>;
+    using SP = SerializePolicy; using IP = IntermediatesPolicy; using BP = BaseCasePolicy; using MP = MultiplyPolicy; using OP = OverlapPolicy;
+    using policy_matrix = matrix<ScalarType,DimensionType,typename SerializePolicy::structure,OffloadEachGemm,typename IntermediatesPolicy::allocator>;
+    using rect_matrix = matrix<ScalarType,DimensionType,rect,OffloadEachGemm,typename IntermediatesPolicy::allocator>;
+    // The buffers one node of the recursion uses, resolved from the tables below once, by plan. A recursive step uses the first five, a base case the rest.
+    struct node{
+      policy_matrix* policy1 = nullptr; policy_matrix* policy2 = nullptr; rect_matrix* rect1 = nullptr; rect_matrix* rect2 = nullptr; rect_matrix* rect3 = nullptr;
+      policy_matrix* base_case = nullptr; std::vector<ScalarType>* base_case_blocked = nullptr; rect_matrix* base_case_cyclic = nullptr; std::pair<MPI_Win,ScalarType*>* base_case_shared = nullptr;
+    };
     info(const info& p) : complete_inv(p.complete_inv), split(p.split), bc_mult_dim(p.bc_mult_dim), dir(p.dir) {}
     info(info&& p) : complete_inv(p.complete_inv), split(p.split), bc_mult_dim(p.bc_mult_dim), dir(p.dir) {}
     info(DimensionType complete_inv, DimensionType split, DimensionType bc_mult_dim, char dir) : complete_inv(complete_inv), split(split), bc_mult_dim(bc_mult_dim), dir(dir) {}
+    ~info(){
+      int finalized; MPI_Finalized(&finalized);
+      if (!finalized){ release_node(); if (plan_group != MPI_GROUP_NULL) MPI_Group_free(&plan_group); }
+    }
     // User input members
     const DimensionType complete_inv;
     const DimensionType split;
@@ -32,17 +45,54 @@ public:
     matrix<ScalarType,DimensionType,typename SerializePolicy::structure> R;
     matrix<ScalarType,DimensionType,typename SerializePolicy::structure> Rinv;
     // Optimizing members
-    std::map<std::pair<DimensionType,DimensionType>,matrix<ScalarType,DimensionType,typename SerializePolicy::structure>> policy_table;
-    std::map<std::pair<DimensionType,DimensionType>,matrix<ScalarType,DimensionType,rect>> rect_table1;
-    std::map<std::pair<DimensionType,DimensionType>,matrix<ScalarType,DimensionType,rect>> rect_table2;
-    std::map<std::pair<DimensionType,DimensionType>,matrix<ScalarType,DimensionType,typename SerializePolicy::structure>> base_case_table;
-    std::map<std::pair<DimensionType,DimensionType>,std::vector<ScalarType>> base_case_blocked_table;
-    std::map<std::pair<DimensionType,DimensionType>,matrix<ScalarType,DimensionType,rect>> base_case_cyclic_table;
+    allocator_lease<typename IntermediatesPolicy::allocator> lease;	// declared ahead of the workspaces, so that it outlives them
+    workspace<std::pair<DimensionType,DimensionType>,policy_matrix> policy_table;
+    workspace<std::pair<DimensionType,DimensionType>,rect_matrix> rect_table1;
+    workspace<std::pair<DimensionType,DimensionType>,rect_matrix> rect_table2;
+    workspace<std::pair<DimensionType,DimensionType>,rect_matrix> rect_table3;	// Rinv11 as a dense operand (Lookahead only)
+    workspace<std::pair<DimensionType,DimensionType>,policy_matrix> base_case_table;
+    workspace<std::pair<DimensionType,DimensionType>,std::vector<ScalarType>> base_case_blocked_table;
+    workspace<std::pair<DimensionType,DimensionType>,rect_matrix> base_case_cyclic_table;
+    workspace<std::pair<DimensionType,DimensionType>,std::pair<MPI_Win,ScalarType*>> base_case_shared_table;	// node-shared R,Rinv buffers (NodeShared only)
+    MPI_Comm node_comm = MPI_COMM_NULL, leader_comm = MPI_COMM_NULL; int num_nodes = 1;
+    int transpose_partner = -1;	// the slice rank holding the transposed block (DistributeComp only)
+    // plan fills the workspaces above and seals them, so that execution cannot allocate an intermediate it missed
+    void seal(bool sealed){
+      policy_table.seal(sealed); rect_table1.seal(sealed); rect_table2.seal(sealed); rect_table3.seal(sealed);
+      base_case_table.seal(sealed); base_case_blocked_table.seal(sealed); base_case_cyclic_table.seal(sealed); base_case_shared_table.seal(sealed);
+    }
+    void clear(){
+      policy_table.clear(); rect_table1.clear(); rect_table2.clear(); rect_table3.clear();
+      base_case_table.clear(); base_case_blocked_table.clear(); base_case_cyclic_table.clear(); release_node();
+    }
+    // The windows and node communicators belong to the planned grid, so they are freed with the plan
+    void release_node(){
+      for (size_t i=0; i<base_case_shared_table.size(); i++){ MPI_Win_unlock_all(base_case_shared_table[i].first); MPI_Win_free(&base_case_shared_table[i].first); }
+      base_case_shared_table.clear();
+      if (leader_comm != MPI_COMM_NULL) MPI_Comm_free(&leader_comm);
+      if (node_comm != MPI_COMM_NULL) MPI_Comm_free(&node_comm);
+      num_nodes = 1;
+    }
+    // Plan members: the nodes in the order invoke visits them, the next one to visit, the base case being executed, and the (N,d,c) and slice group planned for
+    std::vector<node> nodes; size_t node_index; node* bc;
+    std::tuple<DimensionType,size_t,size_t> plan_key; MPI_Group plan_group = MPI_GROUP_NULL;
+    // The plan holds on any slice with the planned one's processes in the same order, e.g. one split again by a rebuilt topo::square
+    bool planned(DimensionType globalDimension, size_t d, size_t c, MPI_Comm slice){
+      if (nodes.empty() || (plan_key != std::make_tuple(globalDimension,d,c))) return false;
+      MPI_Group group; int result; MPI_Comm_group(slice, &group); MPI_Group_compare(group, plan_group, &result); MPI_Group_free(&group);
+      return result == MPI_IDENT;
+    }
     DimensionType localDimension,globalDimension,trueLocalDimension,trueGlobalDimension,bcDimension;
     DimensionType AstartX,AendX,AstartY,AendY,TIstartX,TIendX,TIstartY,TIendY;
     MPI_Request req;
   };
 
+  // Walks the recursion for matrices shaped like A on CommInfo's grid, creating the intermediates and recording each node's buffers in args.
+  //   factor plans on its first call and whenever the shape or grid changes, so that factoring many same-sized matrices
+  //   repeats neither the walk nor any table lookup (nor, under SaveIntermediates, any allocation). Replanning resets R and Rinv.
+  template<typename MatrixType, typename ArgType, typename CommType>
+  static void plan(const MatrixType& A, ArgType& args, CommType&& CommInfo);
+
   template<typename MatrixType, typename ArgType, typename CommType>
   static void factor(const MatrixType& A, ArgType& args, CommType&& CommInfo);
 
@@ -52,12 +102,26 @@ public:
   template<typename ArgType, typename CommType>
   static matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> construct_Rinv(ArgType& args, CommType&& CommInfo);
 
-  using SP = SerializePolicy; using IP = IntermediatesPolicy; using BP = BaseCasePolicy;
+  using SP = SerializePolicy; using IP = IntermediatesPolicy; using BP = BaseCasePolicy; using MP = MultiplyPolicy; using OP = OverlapPolicy;
 
 private:
   template<typename ArgType, typename CommType>
   static void invoke(ArgType& args, CommType&& CommInfo);
 
+  // The inverse completion Rinv12 = -Rinv11*R12*Rinv22, split around the recursion on R22 (dispatched on OverlapPolicy::lookahead).
+  //   initiate_inverse starts whatever of it needs only Rinv11 and R12, and complete_inverse finishes it once Rinv22 is available.
+  template<typename ArgType, typename DimensionType, typename CommType>
+  static std::nullptr_t initiate_inverse(ArgType& args, typename ArgType::node& node, DimensionType split1, DimensionType split2, CommType&& CommInfo, std::false_type);
+
+  template<typename ArgType, typename DimensionType, typename CommType>
+  static auto initiate_inverse(ArgType& args, typename ArgType::node& node, DimensionType split1, DimensionType split2, CommType&& CommInfo, std::true_type);
+
+  template<typename ArgType, typename DimensionType, typename CommType>
+  static void complete_inverse(std::nullptr_t pending, ArgType& args, typename ArgType::node& node, DimensionType split1, DimensionType split2, CommType&& CommInfo);
+
+  template<typename HandleType, typename ArgType, typename DimensionType, typename CommType>
+  static void complete_inverse(std::unique_ptr<HandleType>& pending, ArgType& args, typename ArgType::node& node, DimensionType split1, DimensionType split2, CommType&& CommInfo);
+
   template<typename ArgType, typename CommType>
   static void base_case(ArgType& args, CommType&& CommInfo);
 
@@ -1,16 +1,17 @@
 /* Author: Edward Hutter */
 
 namespace cholesky{
-template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy, class MultiplyPolicy, class OverlapPolicy>
 template<typename MatrixType, typename ArgType, typename CommType>
-void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>::factor(const MatrixType& A, ArgType& args, CommType&& CommInfo){
-  CRITTER_START(CI::factor);
-  using T = typename MatrixType::ScalarType;
+void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>::plan(const MatrixType& A, ArgType& args, CommType&& CommInfo){
   assert(args.split>0); assert(args.dir == 'U');	// Removed support for 'L'. Necessary future support for this case can be handled via a final transpose.
   auto localDimension = A.num_rows_local(); auto globalDimension = A.num_rows_global(); typename ArgType::DimensionType minDimLocal = 1;
+  // A new shape needs none of the old intermediates, nor the pooled buffers they would have been recycled into
+  if (!args.nodes.empty()){ args.R._destroy_(); args.Rinv._destroy_(); args.nodes.clear(); args.clear(); allocator_lease<typename IntermediatesPolicy::allocator>::release(); }
+  args.seal(false);
+  args.transpose_partner = -1;
   args.R._register_(A.num_columns_global(),A.num_rows_global(),CommInfo.d,CommInfo.d);
   args.Rinv._register_(A.num_columns_global(),A.num_rows_global(),CommInfo.d,CommInfo.d);
-  serialize<uppertri,uppertri>::invoke(A,args.R,0,localDimension,0,localDimension,0,localDimension,0,localDimension);
 
   typename ArgType::DimensionType bcDimLocal = CommInfo.c*CommInfo.d; auto bcMult = args.bc_mult_dim;
   if (bcMult<0){ bcMult *= (-1); for (int i=0;i<bcMult; i++) bcDimLocal*=2;} else {for (int i=0;i<bcMult; i++) bcDimLocal/=2;}
@@ -20,35 +21,51 @@ void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>::factor(const M
   args.localDimension=localDimension; args.trueLocalDimension=localDimension; args.globalDimension=globalDimension; args.trueGlobalDimension=globalDimension; args.bcDimension=bcDimension;
   args.AstartX=0; args.AendX=localDimension; args.AstartY=0; args.AendY=localDimension; args.TIstartX=0; args.TIendX=localDimension; args.TIstartY=0; args.TIendY=localDimension;
   simulate(args, std::forward<CommType>(CommInfo));
+  args.seal(true);
+  args.plan_key = std::make_tuple(globalDimension,CommInfo.d,CommInfo.c);
+  if (args.plan_group != MPI_GROUP_NULL){ MPI_Group_free(&args.plan_group); } MPI_Comm_group(CommInfo.slice, &args.plan_group);
+}
 
-  args.localDimension=localDimension; args.trueLocalDimension=localDimension; args.globalDimension=globalDimension; args.trueGlobalDimension=globalDimension; args.bcDimension=bcDimension;
+template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy, class MultiplyPolicy, class OverlapPolicy>
+template<typename MatrixType, typename ArgType, typename CommType>
+void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>::factor(const MatrixType& A, ArgType& args, CommType&& CommInfo){
+  CRITTER_START(CI::factor);
+  auto localDimension = A.num_rows_local(); auto globalDimension = A.num_rows_global();
+  if (!args.planned(globalDimension,CommInfo.d,CommInfo.c,CommInfo.slice)){
+    plan(A, args, std::forward<CommType>(CommInfo));
+  }
+  serialize<uppertri,uppertri>::invoke(A,args.R,0,localDimension,0,localDimension,0,localDimension,0,localDimension);
+
+  args.localDimension=localDimension; args.trueLocalDimension=localDimension; args.globalDimension=globalDimension; args.trueGlobalDimension=globalDimension;
   args.AstartX=0; args.AendX=localDimension; args.AstartY=0; args.AendY=localDimension; args.TIstartX=0; args.TIendX=localDimension; args.TIstartY=0; args.TIendY=localDimension;
+  args.node_index=0;
   invoke(args, std::forward<CommType>(CommInfo));
   CRITTER_STOP(CI::factor);
 }
 
-template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy, class MultiplyPolicy, class OverlapPolicy>
 template<typename ArgType, typename CommType>
-matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>::construct_R(ArgType& args, CommType&& CommInfo){
+matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>::construct_R(ArgType& args, CommType&& CommInfo){
   auto localDimension = args.R.num_rows_local();
   matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> ret(args.R.num_columns_global(),args.R.num_rows_global(),CommInfo.c, CommInfo.c);
   serialize<typename SerializePolicy::structure,rect>::invoke(args.R, ret,0,localDimension,0,localDimension,0,localDimension,0,localDimension);
   return ret;
 }
 
-template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy, class MultiplyPolicy, class OverlapPolicy>
 template<typename ArgType, typename CommType>
-matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>::construct_Rinv(ArgType& args, CommType&& CommInfo){
+matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>::construct_Rinv(ArgType& args, CommType&& CommInfo){
   auto localDimension = args.R.num_rows_local();
   matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> ret(args.Rinv.num_columns_global(),args.Rinv.num_rows_global(),CommInfo.c, CommInfo.c);
   serialize<typename SerializePolicy::structure,rect>::invoke(args.Rinv, ret,0,localDimension,0,localDimension,0,localDimension,0,localDimension);
   return ret;
 }
 
-template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy, class MultiplyPolicy, class OverlapPolicy>
 template<typename ArgType, typename CommType>
-void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>::simulate(ArgType& args, CommType&& CommInfo){
+void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>::simulate(ArgType& args, CommType&& CommInfo){
   auto split1 = (args.localDimension>>args.split); split1 = split1;
+  auto id = args.nodes.size(); args.nodes.emplace_back();	// nodes are recorded in the order invoke visits them
   if (((args.localDimension*CommInfo.d) <= args.bcDimension) || (split1<args.split)){
     simulate_basecase(args, std::forward<CommType>(CommInfo)); return;
   }
@@ -72,28 +89,41 @@ void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>::simulate(ArgTy
   if (!(!args.complete_inv && (args.globalDimension==args.trueGlobalDimension))){
     IP::init(args.policy_table,std::make_pair(split1,split1),nullptr,split1,split1,CommInfo.d,CommInfo.d);
     IP::init(args.policy_table,std::make_pair(split2,split2),nullptr,split2,split2,CommInfo.d,CommInfo.d);
+    if (OP::lookahead){
+      IP::init(args.rect_table3,std::make_pair(split1,split1),nullptr,split1,split1,CommInfo.d,CommInfo.d);
+      args.nodes[id].rect3 = &args.rect_table3.at(std::make_pair(split1,split1));
+    }
   }
+  args.nodes[id].policy1 = &args.policy_table.at(std::make_pair(split1,split1)); args.nodes[id].policy2 = &args.policy_table.at(std::make_pair(split2,split2));
+  args.nodes[id].rect1 = &args.rect_table1.at(std::make_pair(split2,split1)); args.nodes[id].rect2 = &args.rect_table2.at(std::make_pair(split2,split1));
 }
 
-template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy, class MultiplyPolicy, class OverlapPolicy>
 template<typename ArgType, typename CommType>
-void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>::simulate_basecase(ArgType& args, CommType&& CommInfo){
+void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>::simulate_basecase(ArgType& args, CommType&& CommInfo){
   assert(args.localDimension>0); assert((args.AendX-args.AstartX)==(args.AendY-args.AstartY));
   IP::create_buffers(BP::get_id(),args,std::forward<CommType>(CommInfo));
+  auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto& node = args.nodes.back();
+  node.base_case = &args.base_case_table.at(index_pair);
+  if (args.base_case_blocked_table.contains(index_pair)) node.base_case_blocked = &args.base_case_blocked_table.at(index_pair);
+  if (args.base_case_cyclic_table.contains(index_pair)) node.base_case_cyclic = &args.base_case_cyclic_table.at(index_pair);
+  BP::prepare(args, std::forward<CommType>(CommInfo));
 }
 
-template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy, class MultiplyPolicy, class OverlapPolicy>
 template<typename ArgType, typename CommType>
-void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>::invoke(ArgType& args, CommType&& CommInfo){
+void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>::invoke(ArgType& args, CommType&& CommInfo){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(CI::invoke);
 #endif
   using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType;
   auto split1 = (args.localDimension>>args.split); split1 = split1;
+  auto& node = args.nodes[args.node_index++];
   if (((args.localDimension*CommInfo.d) <= args.bcDimension) || (split1<args.split)){
 #ifdef ALGORITHMIC_SYMBOLS
     CRITTER_START(CI::factor_diag);
 #endif
+    args.bc = &node;
     base_case(args, std::forward<CommType>(CommInfo));
 #ifdef ALGORITHMIC_SYMBOLS
     CRITTER_STOP(CI::factor_diag);
@@ -113,14 +143,15 @@ void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>::invoke(ArgType
 #ifdef ALGORITHMIC_SYMBOLS
   CRITTER_START(CI::trsm);
 #endif
-  serialize<uppertri,uppertri>::invoke(args.Rinv, IP::invoke(args.policy_table,std::make_pair(split1,split1)), args.TIstartX, args.TIstartX+split1, args.TIstartY, args.TIstartY+split1,0,split1,0,split1);
-  util::transpose(IP::invoke(args.policy_table,std::make_pair(split1,split1)), std::forward<CommType>(CommInfo));
+  serialize<uppertri,uppertri>::invoke(args.Rinv, IP::invoke(*node.policy1), args.TIstartX, args.TIstartX+split1, args.TIstartY, args.TIstartY+split1,0,split1,0,split1);
+  util::transpose(IP::invoke(*node.policy1), std::forward<CommType>(CommInfo));
   blas::ArgPack_trmm<T> trmmArgs(blas::Order::AblasColumnMajor, blas::Side::AblasLeft, blas::UpLo::AblasUpper, blas::Transpose::AblasTrans, blas::Diag::AblasNonUnit, 1.);
 
-  serialize<rect,rect>::invoke(args.R, IP::invoke(args.rect_table1,std::make_pair(split2,split1)), args.AstartX+split1, args.AendX, args.AstartY, args.AstartY+split1,0,split2,0,split1);
-  matmult::summa::invoke(IP::invoke(args.policy_table,std::make_pair(split1,split1)), IP::invoke(args.rect_table1,std::make_pair(split2,split1)), std::forward<CommType>(CommInfo), trmmArgs);
-  serialize<rect,rect>::invoke(IP::invoke(args.rect_table1,std::make_pair(split2,split1)), args.R, 0,split2,0,split1,args.AstartX+split1, args.AendX, args.AstartY, args.AstartY+split1);
-  serialize<rect,rect>::invoke(IP::invoke(args.rect_table1,std::make_pair(split2,split1)), IP::invoke(args.rect_table2,std::make_pair(split2,split1)),0,split2,0,split1,0,split2,0,split1);
+  auto&& R12 = SP::template stage<rect>(args.R, args.R, IP::invoke(*node.rect1), args.AstartX+split1, args.AendX, args.AstartY, args.AstartY+split1,
+                                         args.AstartX+split1, args.AendX, args.AstartY, args.AstartY+split1);
+  MP::invoke(IP::invoke(*node.policy1), R12, std::forward<CommType>(CommInfo), trmmArgs);
+  SP::template commit<rect>(R12, args.R, args.AstartX+split1, args.AendX, args.AstartY, args.AstartY+split1);
+  serialize<rect,rect>::invoke(R12, IP::invoke(*node.rect2),0,split2,0,split1,0,split2,0,split1);
 #ifdef ALGORITHMIC_SYMBOLS
   CRITTER_STOP(CI::trsm);
 #endif
@@ -129,13 +160,16 @@ void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>::invoke(ArgType
   CRITTER_START(CI::tmu);
 #endif
   blas::ArgPack_syrk<T> syrkArgs(blas::Order::AblasColumnMajor, blas::UpLo::AblasUpper, blas::Transpose::AblasTrans, -1., 1.);
-  serialize<uppertri,uppertri>::invoke(args.R, IP::invoke(args.policy_table,std::make_pair(split2,split2)), args.AstartX+split1, args.AendX, args.AstartY+split1, args.AendY,0,split2,0,split2);
-  matmult::summa::invoke(IP::invoke(args.rect_table1,std::make_pair(split2,split1)), IP::invoke(args.rect_table2,std::make_pair(split2,split1)), IP::invoke(args.policy_table,std::make_pair(split2,split2)), std::forward<CommType>(CommInfo), syrkArgs);
-  serialize<uppertri,uppertri>::invoke(IP::invoke(args.policy_table,std::make_pair(split2,split2)), args.R, 0,split2,0,split2,args.AstartX+split1, args.AendX, args.AstartY+split1, args.AendY);
+  auto&& R22 = SP::template stage<uppertri>(args.R, args.R, IP::invoke(*node.policy2), args.AstartX+split1, args.AendX, args.AstartY+split1, args.AendY,
+                                              args.AstartX+split1, args.AendX, args.AstartY+split1, args.AendY);
+  MP::invoke(R12, IP::invoke(*node.rect2), R22, std::forward<CommType>(CommInfo), syrkArgs);
+  SP::template commit<uppertri>(R22, args.R, args.AstartX+split1, args.AendX, args.AstartY+split1, args.AendY);
 #ifdef ALGORITHMIC_SYMBOLS
   CRITTER_STOP(CI::tmu);
 #endif
 
+  auto pending = initiate_inverse(args, node, split1, split2, std::forward<CommType>(CommInfo), std::integral_constant<bool,OP::lookahead>());
+
   save1 = args.localDimension; save2 = args.globalDimension; save3=args.AstartX; save4=args.AstartY; save5=args.TIstartX; save6=args.TIstartY;
   args.localDimension=split2; args.globalDimension=split2*CommInfo.d; args.AstartX=args.AstartX+split1; args.AstartY=args.AstartY+split1; args.TIstartX=args.TIstartX+split1; args.TIstartY=args.TIstartY+split1;
   invoke(args, std::forward<CommType>(CommInfo));
@@ -144,30 +178,85 @@ void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>::invoke(ArgType
 #ifdef ALGORITHMIC_SYMBOLS
   CRITTER_START(CI::tmu);
 #endif
-  if (!(!args.complete_inv && (args.globalDimension==args.trueGlobalDimension))){
-    serialize<rect,rect>::invoke(args.R, IP::invoke(args.rect_table1,std::make_pair(split2,split1)), args.AstartX+split1, args.AendX, args.AstartY, args.AstartY+split1,0,split2,0,split1);
-    serialize<uppertri,uppertri>::invoke(args.Rinv, IP::invoke(args.policy_table,std::make_pair(split1,split1)), args.TIstartX, args.TIstartX+split1, args.TIstartY, args.TIstartY+split1,0,split1,0,split1);
-    blas::ArgPack_trmm<T> invPackage1(blas::Order::AblasColumnMajor, blas::Side::AblasLeft, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
-    matmult::summa::invoke(IP::invoke(args.policy_table,std::make_pair(split1,split1)), IP::invoke(args.rect_table1,std::make_pair(split2,split1)), std::forward<CommType>(CommInfo), invPackage1);
-    invPackage1.alpha = -1.; invPackage1.side = blas::Side::AblasRight;
-    serialize<uppertri,uppertri>::invoke(args.Rinv, IP::invoke(args.policy_table,std::make_pair(split2,split2)), args.TIstartX+split1, args.TIendX, args.TIstartY+split1, args.TIendY,0,split2,0,split2);
-    matmult::summa::invoke(IP::invoke(args.policy_table,std::make_pair(split2,split2)), IP::invoke(args.rect_table1,std::make_pair(split2,split1)), std::forward<CommType>(CommInfo), invPackage1);
-    serialize<rect,rect>::invoke(IP::invoke(args.rect_table1,std::make_pair(split2,split1)), args.Rinv,0,split2,0,split1,args.TIstartX+split1, args.TIendX, args.TIstartY, args.TIstartY+split1);
-  }
+  complete_inverse(pending, args, node, split1, split2, std::forward<CommType>(CommInfo));
 #ifdef ALGORITHMIC_SYMBOLS
   CRITTER_STOP(CI::tmu);
 #endif
-  IP::flush(args.rect_table1[std::make_pair(split2,split1)]); IP::flush(args.rect_table2[std::make_pair(split2,split1)]);
-  IP::flush(args.policy_table[std::make_pair(split1,split1)]); IP::flush(args.policy_table[std::make_pair(split2,split2)]);
+  IP::flush(*node.rect1); IP::flush(*node.rect2);
+  IP::flush(*node.policy1); IP::flush(*node.policy2);
 #ifdef FUNCTION_SYMBOLS
   CRITTER_STOP(CI::invoke);
 #endif
 }
 
 
-template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy, class MultiplyPolicy, class OverlapPolicy>
+template<typename ArgType, typename DimensionType, typename CommType>
+std::nullptr_t cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>::initiate_inverse(ArgType& args, typename ArgType::node& node, DimensionType split1, DimensionType split2, CommType&& CommInfo, std::false_type){
+  return nullptr;
+}
+
+template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy, class MultiplyPolicy, class OverlapPolicy>
+template<typename ArgType, typename DimensionType, typename CommType>
+auto cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>::initiate_inverse(ArgType& args, typename ArgType::node& node, DimensionType split1, DimensionType split2, CommType&& CommInfo, std::true_type){
+  using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType;
+  using RectType = typename decltype(args.rect_table1)::mapped_type; using HandleType = matmult::summa::handle<RectType,RectType,RectType>;
+  std::unique_ptr<HandleType> pending;
+  if (!args.complete_inv && (args.globalDimension==args.trueGlobalDimension)) return pending;
+  auto& Rinv11 = IP::invoke(*node.rect3);
+  auto& R12 = IP::invoke(*node.rect2);
+  auto& Rinv12 = IP::invoke(*node.rect1);
+  serialize<typename SP::structure,rect>::invoke(args.Rinv, Rinv11, args.TIstartX, args.TIstartX+split1, args.TIstartY, args.TIstartY+split1, 0, split1, 0, split1);
+  // zero the (global) lower triangle, which neither structure keeps zeroed in its own storage
+  for (DimensionType i=0; i<split1; i++){
+    for (DimensionType j=0; j<split1; j++){
+      if ((j*CommInfo.d+CommInfo.y) > (i*CommInfo.d+CommInfo.x)) Rinv11.data()[i*split1+j] = 0;
+    }
+  }
+  // the syrk may have left a broadcast block in rect_table2, so R12 is copied afresh
+  serialize<rect,rect>::invoke(args.R, R12, args.AstartX+split1, args.AendX, args.AstartY, args.AstartY+split1, 0, split2, 0, split1);
+  blas::ArgPack_gemm<T> gemmArgs(blas::Order::AblasColumnMajor, blas::Transpose::AblasNoTrans, blas::Transpose::AblasNoTrans, 1., 0.);
+  pending.reset(new HandleType(matmult::summa::iinvoke(Rinv11, R12, Rinv12, std::forward<CommType>(CommInfo), gemmArgs)));
+  return pending;
+}
+
+template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy, class MultiplyPolicy, class OverlapPolicy>
+template<typename ArgType, typename DimensionType, typename CommType>
+void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>::complete_inverse(std::nullptr_t pending, ArgType& args, typename ArgType::node& node, DimensionType split1, DimensionType split2, CommType&& CommInfo){
+  using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType;
+  if (!(!args.complete_inv && (args.globalDimension==args.trueGlobalDimension))){
+    auto&& Rinv12 = SP::template stage<rect>(args.R, args.Rinv, IP::invoke(*node.rect1), args.AstartX+split1, args.AendX, args.AstartY, args.AstartY+split1,
+                                             args.TIstartX+split1, args.TIendX, args.TIstartY, args.TIstartY+split1);
+    auto&& Rinv11 = SP::template stage<uppertri>(args.Rinv, args.Rinv, IP::invoke(*node.policy1), args.TIstartX, args.TIstartX+split1, args.TIstartY, args.TIstartY+split1,
+                                                 args.TIstartX, args.TIstartX+split1, args.TIstartY, args.TIstartY+split1);
+    blas::ArgPack_trmm<T> invPackage1(blas::Order::AblasColumnMajor, blas::Side::AblasLeft, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
+    MP::invoke(Rinv11, Rinv12, std::forward<CommType>(CommInfo), invPackage1);
+    invPackage1.alpha = -1.; invPackage1.side = blas::Side::AblasRight;
+    auto&& Rinv22 = SP::template stage<uppertri>(args.Rinv, args.Rinv, IP::invoke(*node.policy2), args.TIstartX+split1, args.TIendX, args.TIstartY+split1, args.TIendY,
+                                                 args.TIstartX+split1, args.TIendX, args.TIstartY+split1, args.TIendY);
+    MP::invoke(Rinv22, Rinv12, std::forward<CommType>(CommInfo), invPackage1);
+    SP::template commit<rect>(Rinv12, args.Rinv, args.TIstartX+split1, args.TIendX, args.TIstartY, args.TIstartY+split1);
+  }
+}
+
+template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy, class MultiplyPolicy, class OverlapPolicy>
+template<typename HandleType, typename ArgType, typename DimensionType, typename CommType>
+void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>::complete_inverse(std::unique_ptr<HandleType>& pending, ArgType& args, typename ArgType::node& node, DimensionType split1, DimensionType split2, CommType&& CommInfo){
+  using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType;
+  if (!pending) return;
+  pending->wait(); pending.reset();
+  auto& Rinv12 = IP::invoke(*node.rect1);
+  blas::ArgPack_trmm<T> invPackage(blas::Order::AblasColumnMajor, blas::Side::AblasRight, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, -1.);
+  auto&& Rinv22 = SP::template stage<uppertri>(args.Rinv, args.Rinv, IP::invoke(*node.policy2), args.TIstartX+split1, args.TIendX, args.TIstartY+split1, args.TIendY,
+                                               args.TIstartX+split1, args.TIendX, args.TIstartY+split1, args.TIendY);
+  MP::invoke(Rinv22, Rinv12, std::forward<CommType>(CommInfo), invPackage);
+  serialize<rect,rect>::invoke(Rinv12, args.Rinv, 0, split2, 0, split1, args.TIstartX+split1, args.TIendX, args.TIstartY, args.TIstartY+split1);
+  IP::flush(*node.rect3);
+}
+
+template<class SerializePolicy, class IntermediatesPolicy, class BaseCasePolicy, class MultiplyPolicy, class OverlapPolicy>
 template<typename ArgType, typename CommType>
-void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy>::base_case(ArgType& args, CommType&& CommInfo){
+void cholinv<SerializePolicy,IntermediatesPolicy,BaseCasePolicy,MultiplyPolicy,OverlapPolicy>::base_case(ArgType& args, CommType&& CommInfo){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(CI::base_case);
 #endif
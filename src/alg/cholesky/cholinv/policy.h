@@ -6,40 +6,74 @@ namespace policy{
 namespace cholinv{
 
 // ***********************************************************************************************************************************************************************
+// stage() prepares the [ssx,sex)x[ssy,sey) block of Src for an update whose result belongs in the [dsx,dex)x[dsy,dey) block of Dest,
+//   and commit() places the updated block there. Src and Dest are frequently the same matrix and block.
 class Serialize{
 protected:
   using structure = uppertri;
+
+  // The block is packed into buffer, updated there, and unpacked into Dest
+  template<typename SerializeType, typename SrcType, typename DestType, typename BufferType, typename DimensionType>
+  static BufferType& stage(SrcType& Src, DestType& Dest, BufferType& buffer, DimensionType ssx, DimensionType sex, DimensionType ssy, DimensionType sey,
+                           DimensionType dsx, DimensionType dex, DimensionType dsy, DimensionType dey){
+    serialize<SerializeType,SerializeType>::invoke(Src, buffer, ssx, sex, ssy, sey, 0, sex-ssx, 0, sey-ssy);
+    return buffer;
+  }
+
+  template<typename SerializeType, typename StagedType, typename DestType, typename DimensionType>
+  static void commit(StagedType& staged, DestType& Dest, DimensionType dsx, DimensionType dex, DimensionType dsy, DimensionType dey){
+    serialize<SerializeType,SerializeType>::invoke(staged, Dest, 0, dex-dsx, 0, dey-dsy, dsx, dex, dsy, dey);
+  }
 };
 
 class NoSerialize{
 protected:
   using structure = rect;
+
+  // The block is updated in place through a view onto Dest, with buffer serving as the view's scratch space
+  template<typename SerializeType, typename SrcType, typename DestType, typename BufferType, typename DimensionType>
+  static matrix_view<typename DestType::ScalarType,typename DestType::DimensionType>
+  stage(SrcType& Src, DestType& Dest, BufferType& buffer, DimensionType ssx, DimensionType sex, DimensionType ssy, DimensionType sey,
+        DimensionType dsx, DimensionType dex, DimensionType dsy, DimensionType dey){
+    if ((static_cast<void*>(&Src) != static_cast<void*>(&Dest)) || (ssx != dsx) || (ssy != dsy)){
+      serialize<SerializeType,SerializeType>::invoke(Src, Dest, ssx, sex, ssy, sey, dsx, dex, dsy, dey);
+    }
+    return matrix_view<typename DestType::ScalarType,typename DestType::DimensionType>(Dest, dsx, dex, dsy, dey, buffer.data());
+  }
+
+  template<typename SerializeType, typename StagedType, typename DestType, typename DimensionType>
+  static void commit(StagedType& staged, DestType& Dest, DimensionType dsx, DimensionType dex, DimensionType dsy, DimensionType dey){}
 };
 // ***********************************************************************************************************************************************************************
 
 // ***********************************************************************************************************************************************************************
 class SaveIntermediates{
 protected:
+  using allocator = HeapAllocator;
+
   template<typename TableType, typename KeyType, typename... ValueTypes>
   static void init(TableType& table, KeyType&& key, ValueTypes&&... values){
-    if (table.find(key) == table.end()){
-      table.emplace(std::piecewise_construct,std::forward_as_tuple(std::forward<KeyType>(key)),std::forward_as_tuple(std::forward<ValueTypes>(values)...));
-    }
+    table.emplace(std::forward<KeyType>(key),std::forward<ValueTypes>(values)...);
   }
 
   template<typename TableType, typename KeyType>
   static inline typename TableType::mapped_type& invoke(TableType& table, KeyType&& key){
-    return table[std::forward<KeyType>(key)];
+    return table.at(std::forward<KeyType>(key));
+  }
+
+  template<typename MatrixType>
+  static inline MatrixType& invoke(MatrixType& matrix){
+    return matrix;
   }
 
   template<typename MatrixType>
   static void flush(MatrixType& matrix){}
 
   template<typename ArgType, typename CommType>
-  static void create_buffers(bool bc_strategy_id, ArgType& args, CommType&& CommInfo){
+  static void create_buffers(size_t bc_strategy_id, ArgType& args, CommType&& CommInfo){
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
     init(args.base_case_table, index_pair, nullptr,index_pair.first,index_pair.second,CommInfo.d,CommInfo.d);
-    auto num_elems = args.base_case_table[index_pair].num_elems()*CommInfo.d*CommInfo.d;
+    auto num_elems = args.base_case_table.at(index_pair).num_elems()*CommInfo.d*CommInfo.d;
     if (bc_strategy_id==0){
       init(args.base_case_cyclic_table, index_pair, nullptr,aggregDim,aggregDim,CommInfo.d,CommInfo.d);
       init(args.base_case_blocked_table,index_pair, num_elems);
@@ -50,7 +84,11 @@ protected:
         init(args.base_case_blocked_table,index_pair, num_elems);
       }
     }
-    else if (bc_strategy_id>=2){
+    else if (bc_strategy_id==4){
+      init(args.base_case_cyclic_table, index_pair, nullptr,index_pair.first,index_pair.second,CommInfo.d,CommInfo.d);
+      args.base_case_blocked_table.emplace(index_pair,0);	// sized by DistributeComp::prepare
+    }
+    else if ((bc_strategy_id==2) || (bc_strategy_id==3)){
       if (CommInfo.x==0 && CommInfo.y==0 && CommInfo.z==0){
         init(args.base_case_cyclic_table, index_pair, nullptr,aggregDim,aggregDim,CommInfo.d,CommInfo.d);
         init(args.base_case_blocked_table,index_pair, num_elems);
@@ -58,43 +96,37 @@ protected:
     }
   }
 
+  // The node's buffers mirror what create_buffers made for the base case policy, so only the pointers need checking
   template<typename ArgType, typename CommType>
-  static void init_buffers(bool bc_strategy_id, ArgType& args, CommType&& CommInfo){
-    auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY);
-    auto& m1 = invoke(args.base_case_table,index_pair);
-    if (bc_strategy_id==0){
-      auto& m2 = invoke(args.base_case_cyclic_table,index_pair); auto& m3 = invoke(args.base_case_cyclic_table,index_pair);
-    }
-    else if (bc_strategy_id==1){
-      auto& m3 = invoke(args.base_case_cyclic_table,index_pair);
-      if (CommInfo.z==0){
-        auto& m2 = invoke(args.base_case_cyclic_table,index_pair);
-      }
-    }
-    else if (bc_strategy_id>=2){
-      if (CommInfo.x==0 && CommInfo.y==0 && CommInfo.z==0){
-        auto& m2 = invoke(args.base_case_cyclic_table,index_pair); auto& m3 = invoke(args.base_case_cyclic_table,index_pair);
-      }
-    }
+  static void init_buffers(size_t bc_strategy_id, ArgType& args, CommType&& CommInfo){
+    invoke(*args.bc->base_case);
+    if (args.bc->base_case_cyclic != nullptr){ invoke(*args.bc->base_case_cyclic); }
   }
 
   template<typename ArgType, typename CommType>
-  static void remove_buffers(bool bc_strategy_id, ArgType& args, CommType&& CommInfo){}
+  static void remove_buffers(size_t bc_strategy_id, ArgType& args, CommType&& CommInfo){}
 };
 
 class FlushIntermediates{
 protected:
+  using allocator = PoolAllocator;
+
   template<typename TableType, typename KeyType, typename... ValueTypes>
   static void init(TableType& table, KeyType&& key, ValueTypes&&... values){
-    if (table.find(key) == table.end()){
-      table.emplace(std::piecewise_construct,std::forward_as_tuple(std::forward<KeyType>(key)),std::forward_as_tuple(std::forward<ValueTypes>(values)...,true));
-    }
+    table.emplace(std::forward<KeyType>(key),std::forward<ValueTypes>(values)...,true);
   }
 
   template<typename TableType, typename KeyType>
   static inline typename TableType::mapped_type& invoke(TableType& table, KeyType&& key){
-    table[std::forward<KeyType>(key)]._fill_();
-    return table[std::forward<KeyType>(key)];
+    auto& buffer = table.at(std::forward<KeyType>(key));
+    buffer._fill_();
+    return buffer;
+  }
+
+  template<typename MatrixType>
+  static inline MatrixType& invoke(MatrixType& matrix){
+    matrix._fill_();
+    return matrix;
   }
 
   template<typename MatrixType>
@@ -103,10 +135,10 @@ protected:
   }
 
   template<typename ArgType, typename CommType>
-  static void create_buffers(bool bc_strategy_id, ArgType& args, CommType&& CommInfo){
+  static void create_buffers(size_t bc_strategy_id, ArgType& args, CommType&& CommInfo){
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
     init(args.base_case_table, index_pair, nullptr,index_pair.first,index_pair.second,CommInfo.d,CommInfo.d);
-    auto num_elems = args.base_case_table[index_pair].num_elems()*CommInfo.d*CommInfo.d;
+    auto num_elems = args.base_case_table.at(index_pair).num_elems()*CommInfo.d*CommInfo.d;
     if (bc_strategy_id==0){
       init(args.base_case_cyclic_table, index_pair, nullptr,aggregDim,aggregDim,CommInfo.d,CommInfo.d);
       init(args.base_case_blocked_table,index_pair, num_elems);
@@ -117,7 +149,11 @@ protected:
         init(args.base_case_blocked_table,index_pair, num_elems);
       }
     }
-    else if (bc_strategy_id==2){
+    else if (bc_strategy_id==4){
+      init(args.base_case_cyclic_table, index_pair, nullptr,index_pair.first,index_pair.second,CommInfo.d,CommInfo.d);
+      args.base_case_blocked_table.emplace(index_pair,0);	// sized by DistributeComp::prepare
+    }
+    else if ((bc_strategy_id==2) || (bc_strategy_id==3)){
       if (CommInfo.x==0 && CommInfo.y==0 && CommInfo.z==0){
         init(args.base_case_cyclic_table, index_pair, nullptr,aggregDim,aggregDim,CommInfo.d,CommInfo.d);
         init(args.base_case_blocked_table,index_pair, num_elems);
@@ -125,33 +161,17 @@ protected:
     }
   }
 
+  // The node's buffers mirror what create_buffers made for the base case policy, so only the pointers need checking
   template<typename ArgType, typename CommType>
-  static void init_buffers(bool bc_strategy_id, ArgType& args, CommType&& CommInfo){
-    auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY);
-    auto& m1 = invoke(args.base_case_table,index_pair);
-    if (bc_strategy_id==0){
-      auto& m2 = invoke(args.base_case_cyclic_table,index_pair); auto& m3 = invoke(args.base_case_cyclic_table,index_pair);
-    }
-    else if (bc_strategy_id==1){
-      auto& m3 = invoke(args.base_case_cyclic_table,index_pair);
-      if (CommInfo.z==0){
-        auto& m2 = invoke(args.base_case_cyclic_table,index_pair);
-      }
-    }
-    else if (bc_strategy_id==2){
-      if (CommInfo.x==0 && CommInfo.y==0 && CommInfo.z==0){
-        auto& m2 = invoke(args.base_case_cyclic_table,index_pair); auto& m3 = invoke(args.base_case_cyclic_table,index_pair);
-      }
-    }
+  static void init_buffers(size_t bc_strategy_id, ArgType& args, CommType&& CommInfo){
+    invoke(*args.bc->base_case);
+    if (args.bc->base_case_cyclic != nullptr){ invoke(*args.bc->base_case_cyclic); }
   }
 
   template<typename ArgType, typename CommType>
-  static void remove_buffers(bool bc_strategy_id, ArgType& args, CommType&& CommInfo){
-    auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY);
-    flush(args.base_case_table[index_pair]);
-    if (bc_strategy_id<=1){
-      flush(args.base_case_cyclic_table[index_pair]);
-    }
+  static void remove_buffers(size_t bc_strategy_id, ArgType& args, CommType&& CommInfo){
+    flush(*args.bc->base_case);
+    if (args.bc->base_case_cyclic != nullptr){ flush(*args.bc->base_case_cyclic); }
   }
 };
 // ***********************************************************************************************************************************************************************
@@ -161,6 +181,10 @@ class ReplicateCommComp{
 protected:
   static size_t get_id(){return 0;}
 
+  // Called by plan once per base case, after create_buffers, to finish whatever the base case needs before it executes
+  template<typename ArgType, typename CommType>
+  static void prepare(ArgType& args, CommType&& CommInfo){}
+
   template<typename ArgType, typename CommType>
   static void initiate(ArgType& args, CommType&& CommInfo){
 #ifdef FUNCTION_SYMBOLS
@@ -168,18 +192,18 @@ protected:
 #endif
     using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgType::ScalarType;
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
-    auto localDimension = args.base_case_table[index_pair].num_columns_local();
-    serialize<uppertri,uppertri>::invoke(args.R, args.base_case_table[index_pair], args.AstartX, args.AendX, args.AstartY, args.AendY,0,index_pair.first,0,index_pair.second);
+    auto localDimension = args.bc->base_case->num_columns_local();
+    serialize<uppertri,uppertri>::invoke(args.R, *args.bc->base_case, args.AstartX, args.AendX, args.AstartY, args.AendY,0,index_pair.first,0,index_pair.second);
 #ifdef COLLECTIVE_CONCURRENCY_SOLO
     if (CommInfo.z==0)
 #endif
-    MPI_Allgather(args.base_case_table[index_pair].data(), args.base_case_table[index_pair].num_elems(), mpi_type<T>::type, &args.base_case_blocked_table[index_pair][0],
-                  args.base_case_table[index_pair].num_elems(), mpi_type<T>::type, CommInfo.slice);
+    MPI_Allgather(args.bc->base_case->data(), args.bc->base_case->num_elems(), mpi_type<T>::type, args.bc->base_case_blocked->data(),
+                  args.bc->base_case->num_elems(), mpi_type<T>::type, CommInfo.slice);
     if (std::is_same<typename ArgTypeRR::SP,Serialize>::value){
-      util::block_to_cyclic_triangle(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].data(),
-                                     args.base_case_blocked_table[index_pair].size(), localDimension, localDimension, CommInfo.d);
+      util::block_to_cyclic_triangle(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->data(),
+                                     args.bc->base_case_blocked->size(), localDimension, localDimension, CommInfo.d);
     } else{
-      util::block_to_cyclic_rect(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].data(), localDimension, localDimension, CommInfo.d);
+      util::block_to_cyclic_rect(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->data(), localDimension, localDimension, CommInfo.d);
     }
 #ifdef FUNCTION_SYMBOLS
     CRITTER_STOP(CI::RCC::initiate);
@@ -195,10 +219,8 @@ protected:
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
     auto span = (args.AendX!=args.trueLocalDimension ? aggregDim :aggregDim-(args.trueLocalDimension*CommInfo.d-args.trueGlobalDimension));
     lapack::ArgPack_potrf potrfArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper);
-    lapack::ArgPack_trtri trtriArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper, lapack::Diag::AlapackNonUnit);
-    lapack::engine::_potrf(args.base_case_cyclic_table[index_pair].data(),span,aggregDim,potrfArgs);
-    std::memcpy(args.base_case_cyclic_table[index_pair].scratch(),args.base_case_cyclic_table[index_pair].data(),sizeof(T)*args.base_case_cyclic_table[index_pair].num_elems());
-    lapack::engine::_trtri(args.base_case_cyclic_table[index_pair].scratch(),span,aggregDim,trtriArgs);
+    lapack::engine::_potrf_trtri(args.bc->base_case_cyclic->data(),args.bc->base_case_cyclic->scratch(),span,aggregDim,aggregDim,potrfArgs);
+    std::memcpy(args.bc->base_case_cyclic->scratch()+span*aggregDim,args.bc->base_case_cyclic->data()+span*aggregDim,sizeof(T)*(aggregDim-span)*aggregDim);	// padding
 #ifdef FUNCTION_SYMBOLS
     CRITTER_STOP(CI::RCC::compute);
 #endif
@@ -212,11 +234,11 @@ protected:
     using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgType::ScalarType;
     int rankSlice; MPI_Comm_rank(CommInfo.slice, &rankSlice);
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
-    util::cyclic_to_local(args.base_case_cyclic_table[index_pair].data(),args.base_case_cyclic_table[index_pair].scratch(), args.localDimension, aggregDim, CommInfo.d,rankSlice);
-    serialize<uppertri,uppertri>::invoke(args.base_case_cyclic_table[index_pair], args.R, 0,index_pair.first,0,index_pair.second,args.AstartY, args.AendY, args.AstartY, args.AendY);
-    args.base_case_cyclic_table[index_pair].swap();	// puts the inverse buffer into the `data` member before final serialization
-    serialize<uppertri,uppertri>::invoke(args.base_case_cyclic_table[index_pair], args.Rinv,0,index_pair.first,0,index_pair.second,args.TIstartX, args.TIendX, args.TIstartY, args.TIendY);
-    args.base_case_cyclic_table[index_pair].swap();	// puts the inverse buffer into the `data` member before final serialization
+    util::cyclic_to_local(args.bc->base_case_cyclic->data(),args.bc->base_case_cyclic->scratch(), args.localDimension, aggregDim, CommInfo.d,rankSlice);
+    serialize<uppertri,uppertri>::invoke(*args.bc->base_case_cyclic, args.R, 0,index_pair.first,0,index_pair.second,args.AstartY, args.AendY, args.AstartY, args.AendY);
+    args.bc->base_case_cyclic->swap();	// puts the inverse buffer into the `data` member before final serialization
+    serialize<uppertri,uppertri>::invoke(*args.bc->base_case_cyclic, args.Rinv,0,index_pair.first,0,index_pair.second,args.TIstartX, args.TIendX, args.TIstartY, args.TIendY);
+    args.bc->base_case_cyclic->swap();	// puts the inverse buffer into the `data` member before final serialization
 #ifdef FUNCTION_SYMBOLS
     CRITTER_STOP(CI::RCC::complete);
 #endif
@@ -227,6 +249,9 @@ class ReplicateComp{
 protected:
   static size_t get_id(){return 1;}
 
+  template<typename ArgType, typename CommType>
+  static void prepare(ArgType& args, CommType&& CommInfo){}
+
   template<typename ArgType, typename CommType>
   static void initiate(ArgType& args, CommType&& CommInfo){
 #ifdef FUNCTION_SYMBOLS
@@ -234,16 +259,16 @@ protected:
 #endif
     using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType;
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
-    auto localDimension = args.base_case_table[index_pair].num_columns_local();
+    auto localDimension = args.bc->base_case->num_columns_local();
     if (CommInfo.z==0){
-      serialize<uppertri,uppertri>::invoke(args.R, args.base_case_table[index_pair], args.AstartX, args.AendX, args.AstartY, args.AendY,0,index_pair.first,0,index_pair.second);
-      MPI_Allgather(args.base_case_table[index_pair].data(), args.base_case_table[index_pair].num_elems(), mpi_type<T>::type, &args.base_case_blocked_table[index_pair][0],
-                    args.base_case_table[index_pair].num_elems(), mpi_type<T>::type, CommInfo.slice);
+      serialize<uppertri,uppertri>::invoke(args.R, *args.bc->base_case, args.AstartX, args.AendX, args.AstartY, args.AendY,0,index_pair.first,0,index_pair.second);
+      MPI_Allgather(args.bc->base_case->data(), args.bc->base_case->num_elems(), mpi_type<T>::type, args.bc->base_case_blocked->data(),
+                    args.bc->base_case->num_elems(), mpi_type<T>::type, CommInfo.slice);
       if (std::is_same<typename ArgTypeRR::SP,Serialize>::value){
-        util::block_to_cyclic_triangle(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].data(),
-                                       args.base_case_blocked_table[index_pair].size(), localDimension, localDimension, CommInfo.d);
+        util::block_to_cyclic_triangle(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->data(),
+                                       args.bc->base_case_blocked->size(), localDimension, localDimension, CommInfo.d);
       } else{
-        util::block_to_cyclic_rect(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].data(), localDimension, localDimension, CommInfo.d);
+        util::block_to_cyclic_rect(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->data(), localDimension, localDimension, CommInfo.d);
       }
     }
 #ifdef FUNCTION_SYMBOLS
@@ -261,10 +286,8 @@ protected:
       auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
       auto span = (args.AendX!=args.trueLocalDimension ? aggregDim :aggregDim-(args.trueLocalDimension*CommInfo.d-args.trueGlobalDimension));
       lapack::ArgPack_potrf potrfArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper);
-      lapack::ArgPack_trtri trtriArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper, lapack::Diag::AlapackNonUnit);
-      lapack::engine::_potrf(args.base_case_cyclic_table[index_pair].data(),span,aggregDim,potrfArgs);
-      std::memcpy(args.base_case_cyclic_table[index_pair].scratch(),args.base_case_cyclic_table[index_pair].data(),sizeof(T)*args.base_case_cyclic_table[index_pair].num_elems());
-      lapack::engine::_trtri(args.base_case_cyclic_table[index_pair].scratch(),span,aggregDim,trtriArgs);
+      lapack::engine::_potrf_trtri(args.bc->base_case_cyclic->data(),args.bc->base_case_cyclic->scratch(),span,aggregDim,aggregDim,potrfArgs);
+      std::memcpy(args.bc->base_case_cyclic->scratch()+span*aggregDim,args.bc->base_case_cyclic->data()+span*aggregDim,sizeof(T)*(aggregDim-span)*aggregDim);	// padding
     }
 #ifdef FUNCTION_SYMBOLS
     CRITTER_STOP(CI::RC::compute);
@@ -285,19 +308,19 @@ protected:
 #ifdef COLLECTIVE_CONCURRENCY_LAYER
     if (CommInfo.x==CommInfo.y){
 #endif
-      MPI_Bcast(args.base_case_cyclic_table[index_pair].data(),aggregDim*aggregDim,mpi_type<T>::type,0,CommInfo.depth);
-      MPI_Bcast(args.base_case_cyclic_table[index_pair].scratch(),aggregDim*aggregDim,mpi_type<T>::type,0,CommInfo.depth);
+      MPI_Bcast(args.bc->base_case_cyclic->data(),aggregDim*aggregDim,mpi_type<T>::type,0,CommInfo.depth);
+      MPI_Bcast(args.bc->base_case_cyclic->scratch(),aggregDim*aggregDim,mpi_type<T>::type,0,CommInfo.depth);
 #ifdef COLLECTIVE_CONCURRENCY_SOLO
     }
 #endif
 #ifdef COLLECTIVE_CONCURRENCY_LAYER
     }
 #endif
-    util::cyclic_to_local(args.base_case_cyclic_table[index_pair].data(),args.base_case_cyclic_table[index_pair].scratch(), args.localDimension, aggregDim, CommInfo.d,rankSlice);
-    serialize<uppertri,uppertri>::invoke(args.base_case_cyclic_table[index_pair], args.R, 0,index_pair.first,0,index_pair.second,args.AstartY, args.AendY, args.AstartY, args.AendY);
-    args.base_case_cyclic_table[index_pair].swap();	// puts the inverse buffer into the `data` member before final serialization
-    serialize<uppertri,uppertri>::invoke(args.base_case_cyclic_table[index_pair], args.Rinv,0,index_pair.first,0,index_pair.second,args.TIstartX, args.TIendX, args.TIstartY, args.TIendY);
-    args.base_case_cyclic_table[index_pair].swap();	// puts the inverse buffer into the `data` member before final serialization
+    util::cyclic_to_local(args.bc->base_case_cyclic->data(),args.bc->base_case_cyclic->scratch(), args.localDimension, aggregDim, CommInfo.d,rankSlice);
+    serialize<uppertri,uppertri>::invoke(*args.bc->base_case_cyclic, args.R, 0,index_pair.first,0,index_pair.second,args.AstartY, args.AendY, args.AstartY, args.AendY);
+    args.bc->base_case_cyclic->swap();	// puts the inverse buffer into the `data` member before final serialization
+    serialize<uppertri,uppertri>::invoke(*args.bc->base_case_cyclic, args.Rinv,0,index_pair.first,0,index_pair.second,args.TIstartX, args.TIendX, args.TIstartY, args.TIendY);
+    args.bc->base_case_cyclic->swap();	// puts the inverse buffer into the `data` member before final serialization
 #ifdef FUNCTION_SYMBOLS
     CRITTER_STOP(CI::RC::complete);
 #endif
@@ -308,6 +331,9 @@ class NoReplication{
 protected:
   static size_t get_id(){return 2;}
 
+  template<typename ArgType, typename CommType>
+  static void prepare(ArgType& args, CommType&& CommInfo){}
+
   template<typename ArgType, typename CommType>
   static void initiate(ArgType& args, CommType&& CommInfo){
 #ifdef FUNCTION_SYMBOLS
@@ -315,21 +341,21 @@ protected:
 #endif
     using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType;
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
-    auto localDimension = args.base_case_table[index_pair].num_columns_local();
+    auto localDimension = args.bc->base_case->num_columns_local();
     if (CommInfo.z==0){
-      serialize<uppertri,uppertri>::invoke(args.R, args.base_case_table[index_pair], args.AstartX, args.AendX, args.AstartY, args.AendY,0,index_pair.first,0,index_pair.second);
+      serialize<uppertri,uppertri>::invoke(args.R, *args.bc->base_case, args.AstartX, args.AendX, args.AstartY, args.AendY,0,index_pair.first,0,index_pair.second);
       if (CommInfo.x==0 && CommInfo.y==0){
-        MPI_Gather(args.base_case_table[index_pair].data(), args.base_case_table[index_pair].num_elems(), mpi_type<T>::type, &args.base_case_blocked_table[index_pair][0],
-                   args.base_case_table[index_pair].num_elems(), mpi_type<T>::type, 0, CommInfo.slice);
+        MPI_Gather(args.bc->base_case->data(), args.bc->base_case->num_elems(), mpi_type<T>::type, args.bc->base_case_blocked->data(),
+                   args.bc->base_case->num_elems(), mpi_type<T>::type, 0, CommInfo.slice);
         if (std::is_same<typename ArgTypeRR::SP,Serialize>::value){
-          util::block_to_cyclic_triangle(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].data(),
-                                         args.base_case_blocked_table[index_pair].size(), localDimension, localDimension, CommInfo.d);
+          util::block_to_cyclic_triangle(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->data(),
+                                         args.bc->base_case_blocked->size(), localDimension, localDimension, CommInfo.d);
         } else{
-          util::block_to_cyclic_rect(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].data(), localDimension, localDimension, CommInfo.d);
+          util::block_to_cyclic_rect(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->data(), localDimension, localDimension, CommInfo.d);
         }
       }
       else{
-        MPI_Gather(args.base_case_table[index_pair].data(), args.base_case_table[index_pair].num_elems(), mpi_type<T>::type, nullptr, 0, mpi_type<T>::type, 0, CommInfo.slice);
+        MPI_Gather(args.bc->base_case->data(), args.bc->base_case->num_elems(), mpi_type<T>::type, nullptr, 0, mpi_type<T>::type, 0, CommInfo.slice);
       }
     }
 #ifdef FUNCTION_SYMBOLS
@@ -344,37 +370,35 @@ protected:
 #endif
     using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType;
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
-    auto localDimension = args.base_case_table[index_pair].num_columns_local();
+    auto localDimension = args.bc->base_case->num_columns_local();
     auto span = (args.AendX!=args.trueLocalDimension ? aggregDim :aggregDim-(args.trueLocalDimension*CommInfo.d-args.trueGlobalDimension));
     lapack::ArgPack_potrf potrfArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper);
-    lapack::ArgPack_trtri trtriArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper, lapack::Diag::AlapackNonUnit);
     if (CommInfo.z==0){
       if (CommInfo.x==0 && CommInfo.y==0){
-        lapack::engine::_potrf(args.base_case_cyclic_table[index_pair].data(),span,aggregDim,potrfArgs);
-        std::memcpy(args.base_case_cyclic_table[index_pair].scratch(),args.base_case_cyclic_table[index_pair].data(),sizeof(T)*args.base_case_cyclic_table[index_pair].num_elems());
+        lapack::engine::_potrf_trtri(args.bc->base_case_cyclic->data(),args.bc->base_case_cyclic->scratch(),span,aggregDim,aggregDim,potrfArgs);
+        std::memcpy(args.bc->base_case_cyclic->scratch()+span*aggregDim,args.bc->base_case_cyclic->data()+span*aggregDim,sizeof(T)*(aggregDim-span)*aggregDim);	// padding
         if (std::is_same<typename ArgTypeRR::SP,Serialize>::value){
-          util::cyclic_to_block_triangle(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].data(),
-                                         args.base_case_blocked_table[index_pair].size(), localDimension, localDimension, CommInfo.d);
+          util::cyclic_to_block_triangle(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->data(),
+                                         args.bc->base_case_blocked->size(), localDimension, localDimension, CommInfo.d);
         } else{
-          util::cyclic_to_block_rect(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].data(), localDimension, localDimension, CommInfo.d);
+          util::cyclic_to_block_rect(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->data(), localDimension, localDimension, CommInfo.d);
         }
-        MPI_Scatter(&args.base_case_blocked_table[index_pair][0],args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,args.base_case_table[index_pair].data(),args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,0,CommInfo.slice);
+        MPI_Scatter(args.bc->base_case_blocked->data(),args.bc->base_case->num_elems(),mpi_type<T>::type,args.bc->base_case->data(),args.bc->base_case->num_elems(),mpi_type<T>::type,0,CommInfo.slice);
       }
       else{
-        MPI_Scatter(nullptr,0,mpi_type<T>::type,args.base_case_table[index_pair].data(),args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,0,CommInfo.slice);
+        MPI_Scatter(nullptr,0,mpi_type<T>::type,args.bc->base_case->data(),args.bc->base_case->num_elems(),mpi_type<T>::type,0,CommInfo.slice);
       }
       if (CommInfo.x==0 && CommInfo.y==0){
-        lapack::engine::_trtri(args.base_case_cyclic_table[index_pair].scratch(),span,aggregDim,trtriArgs);
         if (std::is_same<typename ArgTypeRR::SP,Serialize>::value){
-          util::cyclic_to_block_triangle(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].scratch(),
-                                         args.base_case_blocked_table[index_pair].size(), localDimension, localDimension, CommInfo.d);
+          util::cyclic_to_block_triangle(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->scratch(),
+                                         args.bc->base_case_blocked->size(), localDimension, localDimension, CommInfo.d);
         } else{
-          util::cyclic_to_block_rect(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].scratch(), localDimension, localDimension, CommInfo.d);
+          util::cyclic_to_block_rect(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->scratch(), localDimension, localDimension, CommInfo.d);
         }
-        MPI_Scatter(&args.base_case_blocked_table[index_pair][0],args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,args.base_case_table[index_pair].scratch(),args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,0,CommInfo.slice);
+        MPI_Scatter(args.bc->base_case_blocked->data(),args.bc->base_case->num_elems(),mpi_type<T>::type,args.bc->base_case->scratch(),args.bc->base_case->num_elems(),mpi_type<T>::type,0,CommInfo.slice);
       }
       else{
-        MPI_Scatter(nullptr,0,mpi_type<T>::type,args.base_case_table[index_pair].scratch(),args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,0,CommInfo.slice);
+        MPI_Scatter(nullptr,0,mpi_type<T>::type,args.bc->base_case->scratch(),args.bc->base_case->num_elems(),mpi_type<T>::type,0,CommInfo.slice);
       }
     }
 #ifdef FUNCTION_SYMBOLS
@@ -395,18 +419,18 @@ protected:
 #ifdef COLLECTIVE_CONCURRENCY_LAYER
     if (CommInfo.x==CommInfo.y){
 #endif
-      MPI_Bcast(args.base_case_table[index_pair].data(),args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,0,CommInfo.depth);
-      MPI_Bcast(args.base_case_table[index_pair].scratch(),args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,0,CommInfo.depth);
+      MPI_Bcast(args.bc->base_case->data(),args.bc->base_case->num_elems(),mpi_type<T>::type,0,CommInfo.depth);
+      MPI_Bcast(args.bc->base_case->scratch(),args.bc->base_case->num_elems(),mpi_type<T>::type,0,CommInfo.depth);
 #ifdef COLLECTIVE_CONCURRENCY_SOLO
     }
 #endif
 #ifdef COLLECTIVE_CONCURRENCY_LAYER
     }
 #endif
-    serialize<uppertri,uppertri>::invoke(args.base_case_table[index_pair], args.R, 0,index_pair.first,0,index_pair.second,args.AstartY, args.AendY, args.AstartY, args.AendY);
-    args.base_case_table[index_pair].swap();	// puts the inverse buffer into the `data` member before final serialization
-    serialize<uppertri,uppertri>::invoke(args.base_case_table[index_pair], args.Rinv,0,index_pair.first,0,index_pair.second,args.TIstartX, args.TIendX, args.TIstartY, args.TIendY);
-    args.base_case_table[index_pair].swap();	// puts the inverse buffer into the `data` member before final serialization
+    serialize<uppertri,uppertri>::invoke(*args.bc->base_case, args.R, 0,index_pair.first,0,index_pair.second,args.AstartY, args.AendY, args.AstartY, args.AendY);
+    args.bc->base_case->swap();	// puts the inverse buffer into the `data` member before final serialization
+    serialize<uppertri,uppertri>::invoke(*args.bc->base_case, args.Rinv,0,index_pair.first,0,index_pair.second,args.TIstartX, args.TIendX, args.TIstartY, args.TIendY);
+    args.bc->base_case->swap();	// puts the inverse buffer into the `data` member before final serialization
 #ifdef FUNCTION_SYMBOLS
     CRITTER_STOP(CI::NR::complete);
 #endif
@@ -417,6 +441,9 @@ class NoReplicationOverlap{
 protected:
   static size_t get_id(){return 3;}
 
+  template<typename ArgType, typename CommType>
+  static void prepare(ArgType& args, CommType&& CommInfo){}
+
   template<typename ArgType, typename CommType>
   static void initiate(ArgType& args, CommType&& CommInfo){
 #ifdef FUNCTION_SYMBOLS
@@ -424,21 +451,21 @@ protected:
 #endif
     using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType;
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
-    auto localDimension = args.base_case_table[index_pair].num_columns_local();
+    auto localDimension = args.bc->base_case->num_columns_local();
     if (CommInfo.z==0){
-      serialize<uppertri,uppertri>::invoke(args.R, args.base_case_table[index_pair], args.AstartX, args.AendX, args.AstartY, args.AendY,0,index_pair.first,0,index_pair.second);
+      serialize<uppertri,uppertri>::invoke(args.R, *args.bc->base_case, args.AstartX, args.AendX, args.AstartY, args.AendY,0,index_pair.first,0,index_pair.second);
       if (CommInfo.x==0 && CommInfo.y==0){
-        MPI_Gather(args.base_case_table[index_pair].data(), args.base_case_table[index_pair].num_elems(), mpi_type<T>::type, &args.base_case_blocked_table[index_pair][0],
-                   args.base_case_table[index_pair].num_elems(), mpi_type<T>::type, 0, CommInfo.slice);
+        MPI_Gather(args.bc->base_case->data(), args.bc->base_case->num_elems(), mpi_type<T>::type, args.bc->base_case_blocked->data(),
+                   args.bc->base_case->num_elems(), mpi_type<T>::type, 0, CommInfo.slice);
         if (std::is_same<typename ArgTypeRR::SP,Serialize>::value){
-          util::block_to_cyclic_triangle(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].data(),
-                                         args.base_case_blocked_table[index_pair].size(), localDimension, localDimension, CommInfo.d);
+          util::block_to_cyclic_triangle(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->data(),
+                                         args.bc->base_case_blocked->size(), localDimension, localDimension, CommInfo.d);
         } else{
-          util::block_to_cyclic_rect(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].data(), localDimension, localDimension, CommInfo.d);
+          util::block_to_cyclic_rect(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->data(), localDimension, localDimension, CommInfo.d);
         }
       }
       else{
-        MPI_Gather(args.base_case_table[index_pair].data(), args.base_case_table[index_pair].num_elems(), mpi_type<T>::type, nullptr, 0, mpi_type<T>::type, 0, CommInfo.slice);
+        MPI_Gather(args.bc->base_case->data(), args.bc->base_case->num_elems(), mpi_type<T>::type, nullptr, 0, mpi_type<T>::type, 0, CommInfo.slice);
       }
     }
 #ifdef FUNCTION_SYMBOLS
@@ -453,42 +480,42 @@ protected:
 #endif
     using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType;
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
-    auto localDimension = args.base_case_table[index_pair].num_columns_local(); MPI_Status st;
+    auto localDimension = args.bc->base_case->num_columns_local(); MPI_Status st;
     auto span = (args.AendX!=args.trueLocalDimension ? aggregDim :aggregDim-(args.trueLocalDimension*CommInfo.d-args.trueGlobalDimension));
     lapack::ArgPack_potrf potrfArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper);
     lapack::ArgPack_trtri trtriArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper, lapack::Diag::AlapackNonUnit);
     if (CommInfo.z==0){
       if (CommInfo.x==0 && CommInfo.y==0){
-        lapack::engine::_potrf(args.base_case_cyclic_table[index_pair].data(),span,aggregDim,potrfArgs);
-        std::memcpy(args.base_case_cyclic_table[index_pair].scratch(),args.base_case_cyclic_table[index_pair].data(),sizeof(T)*args.base_case_cyclic_table[index_pair].num_elems());
+        lapack::engine::_potrf(args.bc->base_case_cyclic->data(),span,aggregDim,potrfArgs);
+        std::memcpy(args.bc->base_case_cyclic->scratch(),args.bc->base_case_cyclic->data(),sizeof(T)*args.bc->base_case_cyclic->num_elems());
         if (std::is_same<typename ArgTypeRR::SP,Serialize>::value){
-          util::cyclic_to_block_triangle(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].data(),
-                                         args.base_case_blocked_table[index_pair].size(), localDimension, localDimension, CommInfo.d);
+          util::cyclic_to_block_triangle(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->data(),
+                                         args.bc->base_case_blocked->size(), localDimension, localDimension, CommInfo.d);
         } else{
-          util::cyclic_to_block_rect(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].data(), localDimension, localDimension, CommInfo.d);
+          util::cyclic_to_block_rect(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->data(), localDimension, localDimension, CommInfo.d);
         }
-        MPI_Iscatter(&args.base_case_blocked_table[index_pair][0],args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,args.base_case_table[index_pair].data(),args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,0,CommInfo.slice, &args.req);
+        MPI_Iscatter(args.bc->base_case_blocked->data(),args.bc->base_case->num_elems(),mpi_type<T>::type,args.bc->base_case->data(),args.bc->base_case->num_elems(),mpi_type<T>::type,0,CommInfo.slice, &args.req);
       }
       else{
-        MPI_Iscatter(nullptr,0,mpi_type<T>::type,args.base_case_table[index_pair].data(),args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,0,CommInfo.slice,&args.req);
+        MPI_Iscatter(nullptr,0,mpi_type<T>::type,args.bc->base_case->data(),args.bc->base_case->num_elems(),mpi_type<T>::type,0,CommInfo.slice,&args.req);
       }
       if (CommInfo.x==0 && CommInfo.y==0){
-        lapack::engine::_trtri(args.base_case_cyclic_table[index_pair].scratch(),span,aggregDim,trtriArgs);
+        lapack::engine::_trtri(args.bc->base_case_cyclic->scratch(),span,aggregDim,trtriArgs);
         MPI_Wait(&args.req,&st);
         if (std::is_same<typename ArgTypeRR::SP,Serialize>::value){
-          util::cyclic_to_block_triangle(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].scratch(),
-                                         args.base_case_blocked_table[index_pair].size(), localDimension, localDimension, CommInfo.d);
+          util::cyclic_to_block_triangle(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->scratch(),
+                                         args.bc->base_case_blocked->size(), localDimension, localDimension, CommInfo.d);
         } else{
-          util::cyclic_to_block_rect(&args.base_case_blocked_table[index_pair][0], args.base_case_cyclic_table[index_pair].scratch(), localDimension, localDimension, CommInfo.d);
+          util::cyclic_to_block_rect(args.bc->base_case_blocked->data(), args.bc->base_case_cyclic->scratch(), localDimension, localDimension, CommInfo.d);
         }
-        MPI_Iscatter(&args.base_case_blocked_table[index_pair][0],args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,args.base_case_table[index_pair].scratch(),args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,0,CommInfo.slice,&args.req);
+        MPI_Iscatter(args.bc->base_case_blocked->data(),args.bc->base_case->num_elems(),mpi_type<T>::type,args.bc->base_case->scratch(),args.bc->base_case->num_elems(),mpi_type<T>::type,0,CommInfo.slice,&args.req);
       }
       else{
         MPI_Wait(&args.req,&st);
-        MPI_Iscatter(nullptr,0,mpi_type<T>::type,args.base_case_table[index_pair].scratch(),args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,0,CommInfo.slice,&args.req);
+        MPI_Iscatter(nullptr,0,mpi_type<T>::type,args.bc->base_case->scratch(),args.bc->base_case->num_elems(),mpi_type<T>::type,0,CommInfo.slice,&args.req);
       }
     }
-    MPI_Bcast(args.base_case_table[index_pair].data(),args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,0,CommInfo.depth);
+    MPI_Bcast(args.bc->base_case->data(),args.bc->base_case->num_elems(),mpi_type<T>::type,0,CommInfo.depth);
 #ifdef FUNCTION_SYMBOLS
     CRITTER_STOP(CI::NRO::compute);
 #endif
@@ -502,17 +529,256 @@ protected:
     using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType;
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); MPI_Status st;
     if (CommInfo.z==0){ MPI_Wait(&args.req,&st); }
-    MPI_Bcast(args.base_case_table[index_pair].scratch(),args.base_case_table[index_pair].num_elems(),mpi_type<T>::type,0,CommInfo.depth);
-    serialize<uppertri,uppertri>::invoke(args.base_case_table[index_pair], args.R, 0,index_pair.first,0,index_pair.second,args.AstartY, args.AendY, args.AstartY, args.AendY);
-    args.base_case_table[index_pair].swap();	// puts the inverse buffer into the `data` member before final serialization
-    serialize<uppertri,uppertri>::invoke(args.base_case_table[index_pair], args.Rinv,0,index_pair.first,0,index_pair.second,args.TIstartX, args.TIendX, args.TIstartY, args.TIendY);
-    args.base_case_table[index_pair].swap();	// puts the inverse buffer into the `data` member before final serialization
+    MPI_Bcast(args.bc->base_case->scratch(),args.bc->base_case->num_elems(),mpi_type<T>::type,0,CommInfo.depth);
+    serialize<uppertri,uppertri>::invoke(*args.bc->base_case, args.R, 0,index_pair.first,0,index_pair.second,args.AstartY, args.AendY, args.AstartY, args.AendY);
+    args.bc->base_case->swap();	// puts the inverse buffer into the `data` member before final serialization
+    serialize<uppertri,uppertri>::invoke(*args.bc->base_case, args.Rinv,0,index_pair.first,0,index_pair.second,args.TIstartX, args.TIendX, args.TIstartY, args.TIendY);
+    args.bc->base_case->swap();	// puts the inverse buffer into the `data` member before final serialization
 #ifdef FUNCTION_SYMBOLS
     CRITTER_STOP(CI::NRO::complete);
 #endif
   }
 };
 
+// Every slice factors the base case cooperatively, in place on its cyclic distribution, rather than gathering it to one process.
+//   The slice runs a right-looking blocked factorization over panels of panel_dim(d) local columns, carrying R^{-T} (initially the identity) along in scratch,
+//   so that each panel costs an allgather along columns, one along rows and a broadcast along rows. R^{-T} is transposed into R^{-1} by one exchange at the end.
+//   Each layer computes the same result, so nothing is communicated along depth.
+class DistributeComp{
+protected:
+  static size_t get_id(){return 4;}
+
+  template<typename DimensionType>
+  static DimensionType panel_dim(DimensionType localDimension, DimensionType sliceDim){
+    return std::min(localDimension,std::max(DimensionType(1),DimensionType(64)/sliceDim));
+  }
+
+  // The panel workspace is sized for this base case, and the transpose partner is found once per grid
+  template<typename ArgType, typename CommType>
+  static void prepare(ArgType& args, CommType&& CommInfo){
+    using ArgTypeRR = typename std::remove_reference<ArgType>::type; using U = typename ArgTypeRR::DimensionType;
+    U n = args.AendX-args.AstartX; U d = CommInfo.d; U w = panel_dim(n,d); U P = w*d;
+    args.nodes.back().base_case_blocked->resize(w*2*n + 3*P*2*n + 3*P*P);
+    if (args.transpose_partner >= 0) return;
+    // R^{-1} on (x,y) is the local transpose of R^{-T} on (y,x)
+    int coords[2] = {static_cast<int>(CommInfo.x),static_cast<int>(CommInfo.y)}; int sliceSize;
+    MPI_Comm_size(CommInfo.slice,&sliceSize); std::vector<int> all(2*sliceSize);
+    MPI_Allgather(coords, 2, MPI_INT, &all[0], 2, MPI_INT, CommInfo.slice);
+    for (args.transpose_partner=0; args.transpose_partner<sliceSize; args.transpose_partner++){
+      if ((all[2*args.transpose_partner]==coords[1]) && (all[2*args.transpose_partner+1]==coords[0])) break;
+    }
+  }
+
+  template<typename ArgType, typename CommType>
+  static void initiate(ArgType& args, CommType&& CommInfo){
+#ifdef FUNCTION_SYMBOLS
+    CRITTER_START(CI::DC::initiate);
+#endif
+    using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType; using U = typename ArgTypeRR::DimensionType;
+    auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); U n = index_pair.first; U d = CommInfo.d;
+    auto& A = *args.bc->base_case_cyclic;
+    std::fill(A.data(),A.data()+n*n,T(0)); std::fill(A.scratch(),A.scratch()+n*n,T(0));
+    serialize<uppertri,uppertri>::invoke(args.R, A, args.AstartX, args.AendX, args.AstartY, args.AendY,0,n,0,n);
+    if (CommInfo.x==CommInfo.y){ for (U i=0; i<n; i++){ A.scratch()[i*n+i]=T(1); } }
+#ifdef FUNCTION_SYMBOLS
+    CRITTER_STOP(CI::DC::initiate);
+#endif
+  }
+
+  template<typename ArgType, typename CommType>
+  static void compute(ArgType&& args, CommType&& CommInfo){
+#ifdef FUNCTION_SYMBOLS
+    CRITTER_START(CI::DC::compute);
+#endif
+    using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType; using U = typename ArgTypeRR::DimensionType;
+    auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); U n = index_pair.first; U d = CommInfo.d; U x = CommInfo.x; U y = CommInfo.y;
+    auto aggregDim = n*d;
+    auto span = (args.AendX!=args.trueLocalDimension ? aggregDim :aggregDim-(args.trueLocalDimension*CommInfo.d-args.trueGlobalDimension));
+    auto& A = *args.bc->base_case_cyclic; T* R = A.data(); T* Y = A.scratch();
+    lapack::ArgPack_potrf potrfArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper);
+    blas::ArgPack_gemm<T> solveArgs(blas::Order::AblasColumnMajor, blas::Transpose::AblasTrans, blas::Transpose::AblasNoTrans, 1., 0.);
+    blas::ArgPack_gemm<T> updateArgs(blas::Order::AblasColumnMajor, blas::Transpose::AblasTrans, blas::Transpose::AblasNoTrans, -1., 1.);
+    U w = panel_dim(n,d);
+    for (U k0=0; k0<n; k0+=w){
+      U k1 = std::min(n,k0+w); U wl = k1-k0; U P = wl*d; U m = k1+n-k0;	// panel rows carry Y's columns [0,k1) followed by R's columns [k0,n)
+      T* send = args.bc->base_case_blocked->data(); T* recv = send+wl*m; T* G = recv+P*m; T* D = G+P*m; T* Dinv = D+P*P; T* slabs = Dinv+P*P;
+      for (U j=0; j<k1; j++){ for (U i=0; i<wl; i++){ send[j*wl+i] = Y[j*n+k0+i]; } }
+      for (U j=k0; j<n; j++){ for (U i=0; i<wl; i++){ send[(k1+j-k0)*wl+i] = R[j*n+k0+i]; } }
+      // G holds the panel rows (in global order) of this process column's columns
+      MPI_Allgather(send, wl*m, mpi_type<T>::type, recv, wl*m, mpi_type<T>::type, CommInfo.column);
+      for (U r=0; r<d; r++){ for (U j=0; j<m; j++){ for (U i=0; i<wl; i++){ G[j*P+i*d+r] = recv[r*wl*m+j*wl+i]; } } }
+      MPI_Allgather(&G[k1*P], P*wl, mpi_type<T>::type, slabs, P*wl, mpi_type<T>::type, CommInfo.row);
+      for (U r=0; r<d; r++){ for (U j=0; j<wl; j++){ std::memcpy(&D[(j*d+r)*P], &slabs[(r*wl+j)*P], P*sizeof(T)); } }
+      // the diagonal block is factored redundantly; indices past span are padding, decoupled with an identity block
+      U real = std::max(U(0),std::min(P,U(span)-k0*d));
+      for (U j=0; j<P; j++){ for (U i=0; i<P; i++){ if ((i>j) || ((j>=real) && (i!=j))) D[j*P+i]=T(0); else if ((j>=real) && (i==j)) D[j*P+i]=T(1); } }
+      // _potrf_trtri writes only Dinv's upper triangle, and the workspace behind it holds a previous (possibly wider) panel's data
+      std::fill(Dinv,Dinv+P*P,T(0));
+      if (real>0) lapack::engine::_potrf_trtri(D,Dinv,real,P,P,potrfArgs);
+      std::memcpy(Dinv+real*P,D+real*P,(P-real)*P*sizeof(T));
+      // every panel row of [Y | R] is solved with R_kk^{-T}, and this process keeps its own
+      blas::engine::_gemm(Dinv, G, recv, P, m, P, P, P, P, solveArgs);
+      for (U j=0; j<m; j++){ for (U i=0; i<wl; i++){ if (j<k1) Y[j*n+k0+i] = recv[j*P+i*d+y]; else R[(k0+j-k1)*n+k0+i] = recv[j*P+i*d+y]; } }
+      for (U j=0; j<wl; j++){ for (U i=0; i<wl; i++){ R[(k0+j)*n+k0+i] = D[(j*d+x)*P+i*d+y]; } }
+      if (k1==n) continue;
+      // the panel columns owned by process column y hold the rows of this process' trailing block
+      T* L = G; T* right = &recv[(2*k1-k0)*P];
+      if (x==y) std::memcpy(L, right, P*(n-k1)*sizeof(T));
+      MPI_Bcast(L, P*(n-k1), mpi_type<T>::type, y, CommInfo.row);
+      blas::engine::_gemm(L, right, &R[k1*n+k1], n-k1, n-k1, P, P, P, n, updateArgs);
+      blas::engine::_gemm(L, recv, &Y[k1], n-k1, k1, P, P, P, n, updateArgs);
+    }
+#ifdef FUNCTION_SYMBOLS
+    CRITTER_STOP(CI::DC::compute);
+#endif
+  }
+
+  template<typename ArgType, typename CommType>
+  static void complete(ArgType& args, CommType&& CommInfo){
+#ifdef FUNCTION_SYMBOLS
+    CRITTER_START(CI::DC::complete);
+#endif
+    using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType; using U = typename ArgTypeRR::DimensionType;
+    auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); U n = index_pair.first;
+    auto& A = *args.bc->base_case_cyclic;
+    MPI_Sendrecv(A.scratch(), n*n, mpi_type<T>::type, args.transpose_partner, 0, A.pad(), n*n, mpi_type<T>::type, args.transpose_partner, 0, CommInfo.slice, MPI_STATUS_IGNORE);
+    for (U j=0; j<n; j++){ for (U i=0; i<n; i++){ A.scratch()[j*n+i] = A.pad()[i*n+j]; } }
+    serialize<uppertri,uppertri>::invoke(A, args.R, 0,index_pair.first,0,index_pair.second,args.AstartY, args.AendY, args.AstartY, args.AendY);
+    A.swap();	// puts the inverse buffer into the `data` member before final serialization
+    serialize<uppertri,uppertri>::invoke(A, args.Rinv,0,index_pair.first,0,index_pair.second,args.TIstartX, args.TIendX, args.TIstartY, args.TIendY);
+    A.swap();	// puts the inverse buffer into the `data` member before final serialization
+#ifdef FUNCTION_SYMBOLS
+    CRITTER_STOP(CI::DC::complete);
+#endif
+  }
+};
+
+// The slice's processes that share a node write their blocks straight into one cyclic buffer allocated (once per base case size) with MPI_Win_allocate_shared,
+//   and one process per node factors it, with the node's cores when MKL is threaded. Only the sum that assembles the buffer across nodes goes over the network.
+//   Each layer computes the same result, so nothing is communicated along depth. The node communicators are split from the slice of the planned grid.
+class NodeShared{
+protected:
+  static size_t get_id(){return 5;}
+
+  // The node communicators are split from the planned slice once per plan, and each base case size gets its window here, so that execution only synchronizes
+  template<typename ArgType, typename CommType>
+  static void prepare(ArgType& args, CommType&& CommInfo){
+    using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType;
+    auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
+    int rankSlice, rankNode; MPI_Comm_rank(CommInfo.slice, &rankSlice);
+    if (args.node_comm == MPI_COMM_NULL){
+      MPI_Comm_split_type(CommInfo.slice, MPI_COMM_TYPE_SHARED, rankSlice, MPI_INFO_NULL, &args.node_comm);
+      MPI_Comm_rank(args.node_comm, &rankNode);
+      MPI_Comm_split(CommInfo.slice, (rankNode==0 ? 0 : MPI_UNDEFINED), rankSlice, &args.leader_comm);
+      if (rankNode==0){ MPI_Comm_size(args.leader_comm, &args.num_nodes); }
+      MPI_Bcast(&args.num_nodes, 1, MPI_INT, 0, args.node_comm);
+    }
+    MPI_Comm_rank(args.node_comm, &rankNode);
+    if (!args.base_case_shared_table.contains(index_pair)){
+      MPI_Win win; T* buffer; MPI_Aint size; int disp;
+      MPI_Win_allocate_shared((rankNode==0 ? 2*aggregDim*aggregDim*sizeof(T) : 0), sizeof(T), MPI_INFO_NULL, args.node_comm, &buffer, &win);
+      MPI_Win_shared_query(win, 0, &size, &disp, &buffer);
+      MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+      args.base_case_shared_table.emplace(index_pair, win, buffer);
+    }
+    args.nodes.back().base_case_shared = &args.base_case_shared_table.at(index_pair);
+  }
+
+  template<typename ArgType, typename CommType>
+  static void initiate(ArgType& args, CommType&& CommInfo){
+#ifdef FUNCTION_SYMBOLS
+    CRITTER_START(CI::NS::initiate);
+#endif
+    using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType; using U = typename ArgTypeRR::DimensionType;
+    auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); U n = index_pair.first; U d = CommInfo.d; auto aggregDim = n*d;
+    int rankNode; MPI_Comm_rank(args.node_comm, &rankNode);
+    auto& shared = *args.bc->base_case_shared; T* R = shared.second;
+    // blocks are summed across nodes, so entries no process writes must be zero
+    if ((rankNode==0) && (args.num_nodes>1)){ std::fill(R, R+aggregDim*aggregDim, T(0)); }
+    MPI_Win_sync(shared.first); MPI_Barrier(args.node_comm); MPI_Win_sync(shared.first);
+    for (U j=0; j<n; j++){
+      for (U i=0; i<=j; i++){
+        R[(j*d+CommInfo.x)*aggregDim+i*d+CommInfo.y] = args.R.data()[args.R.offset_local(args.AstartX+j,args.AstartY+i)];
+      }
+    }
+    MPI_Win_sync(shared.first); MPI_Barrier(args.node_comm); MPI_Win_sync(shared.first);
+    if ((rankNode==0) && (args.num_nodes>1)){
+      MPI_Allreduce(MPI_IN_PLACE, R, aggregDim*aggregDim, mpi_type<T>::type, MPI_SUM, args.leader_comm);
+    }
+#ifdef FUNCTION_SYMBOLS
+    CRITTER_STOP(CI::NS::initiate);
+#endif
+  }
+
+  template<typename ArgType, typename CommType>
+  static void compute(ArgType&& args, CommType&& CommInfo){
+#ifdef FUNCTION_SYMBOLS
+    CRITTER_START(CI::NS::compute);
+#endif
+    using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType;
+    auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
+    auto span = (args.AendX!=args.trueLocalDimension ? aggregDim :aggregDim-(args.trueLocalDimension*CommInfo.d-args.trueGlobalDimension));
+    auto& shared = *args.bc->base_case_shared; T* R = shared.second; T* Rinv = R+aggregDim*aggregDim;
+    int rankNode, sizeNode; MPI_Comm_rank(args.node_comm, &rankNode); MPI_Comm_size(args.node_comm, &sizeNode);
+    if (rankNode==0){
+      lapack::ArgPack_potrf potrfArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper);
+#ifdef MKL
+      mkl_set_num_threads_local(sizeNode);	// the rest of the node waits at the barrier below
+#endif
+      lapack::engine::_potrf_trtri(R,Rinv,span,aggregDim,aggregDim,potrfArgs);
+      std::memcpy(Rinv+span*aggregDim,R+span*aggregDim,sizeof(T)*(aggregDim-span)*aggregDim);
+#ifdef MKL
+      mkl_set_num_threads_local(0);
+#endif
+    }
+    MPI_Win_sync(shared.first); MPI_Barrier(args.node_comm); MPI_Win_sync(shared.first);
+#ifdef FUNCTION_SYMBOLS
+    CRITTER_STOP(CI::NS::compute);
+#endif
+  }
+
+  template<typename ArgType, typename CommType>
+  static void complete(ArgType& args, CommType&& CommInfo){
+#ifdef FUNCTION_SYMBOLS
+    CRITTER_START(CI::NS::complete);
+#endif
+    using ArgTypeRR = typename std::remove_reference<ArgType>::type; using T = typename ArgTypeRR::ScalarType; using U = typename ArgTypeRR::DimensionType;
+    auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); U n = index_pair.first; U d = CommInfo.d; auto aggregDim = n*d;
+    auto& shared = *args.bc->base_case_shared; T* R = shared.second; T* Rinv = R+aggregDim*aggregDim;
+    auto& block = *args.bc->base_case;
+    for (U j=0; j<n; j++){
+      for (U i=0; i<=j; i++){
+        U row = i*d+CommInfo.y, col = j*d+CommInfo.x; auto offset = block.offset_local(j,i);
+        block.data()[offset] = (row<=col ? R[col*aggregDim+row] : T(0)); block.scratch()[offset] = (row<=col ? Rinv[col*aggregDim+row] : T(0));
+      }
+    }
+    // the buffer is overwritten by the next base case of this size only once every process has read its block
+    MPI_Win_sync(shared.first); MPI_Barrier(args.node_comm);
+    serialize<uppertri,uppertri>::invoke(block, args.R, 0,index_pair.first,0,index_pair.second,args.AstartY, args.AendY, args.AstartY, args.AendY);
+    block.swap();	// puts the inverse buffer into the `data` member before final serialization
+    serialize<uppertri,uppertri>::invoke(block, args.Rinv,0,index_pair.first,0,index_pair.second,args.TIstartX, args.TIendX, args.TIstartY, args.TIendY);
+    block.swap();	// puts the inverse buffer into the `data` member before final serialization
+#ifdef FUNCTION_SYMBOLS
+    CRITTER_STOP(CI::NS::complete);
+#endif
+  }
+};
+// ***********************************************************************************************************************************************************************
+
+// ***********************************************************************************************************************************************************************
+// The inverse completion of each recursive step, Rinv12 = -Rinv11*R12*Rinv22, starts once the recursion on R22 has returned
+class NoLookahead{
+protected:
+  static constexpr bool lookahead = false;
+};
+
+// Rinv11*R12 is started (via matmult::summa::iinvoke) as soon as the trailing syrk is done, so that its broadcasts progress under the recursion on R22,
+//   leaving only the trmm with Rinv22 for when the recursion returns. iinvoke is gemm-only, so Rinv11 takes part as a dense copy with its lower triangle zeroed.
+class Lookahead{
+protected:
+  static constexpr bool lookahead = true;
+};
+
 };
 };
 };
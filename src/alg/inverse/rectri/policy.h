@@ -22,14 +22,12 @@ class SaveIntermediates{
 protected:
   template<typename TableType, typename KeyType, typename... ValueTypes>
   static void init(TableType& table, KeyType&& key, ValueTypes&&... values){
-    if (table.find(key) == table.end()){
-      table.emplace(std::piecewise_construct,std::forward_as_tuple(std::forward<KeyType>(key)),std::forward_as_tuple(std::forward<ValueTypes>(values)...));
-    }
+    table.emplace(std::forward<KeyType>(key),std::forward<ValueTypes>(values)...);
   }
 
   template<typename TableType, typename KeyType>
   static inline typename TableType::mapped_type& invoke(TableType& table, KeyType&& key){
-    return table[std::forward<KeyType>(key)];
+    return table.at(std::forward<KeyType>(key));
   }
 
   template<typename MatrixType>
@@ -39,7 +37,7 @@ protected:
   static void create_buffers(bool bc_strategy_id, ArgType& args, CommType&& CommInfo){
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
     init(args.base_case_table, index_pair, nullptr,index_pair.first,index_pair.second,CommInfo.d,CommInfo.d);
-    auto num_elems = args.base_case_table[index_pair].num_elems()*CommInfo.d*CommInfo.d;
+    auto num_elems = args.base_case_table.at(index_pair).num_elems()*CommInfo.d*CommInfo.d;
     if (bc_strategy_id==0){
       init(args.base_case_cyclic_table, index_pair, nullptr,aggregDim,aggregDim,CommInfo.d,CommInfo.d);
       init(args.base_case_blocked_table,index_pair, num_elems);
@@ -86,15 +84,14 @@ class FlushIntermediates{
 protected:
   template<typename TableType, typename KeyType, typename... ValueTypes>
   static void init(TableType& table, KeyType&& key, ValueTypes&&... values){
-    if (table.find(key) == table.end()){
-      table.emplace(std::piecewise_construct,std::forward_as_tuple(std::forward<KeyType>(key)),std::forward_as_tuple(std::forward<ValueTypes>(values)...,true));
-    }
+    table.emplace(std::forward<KeyType>(key),std::forward<ValueTypes>(values)...,true);
   }
 
   template<typename TableType, typename KeyType>
   static inline typename TableType::mapped_type& invoke(TableType& table, KeyType&& key){
-    table[std::forward<KeyType>(key)]._fill_();
-    return table[std::forward<KeyType>(key)];
+    auto& buffer = table.at(std::forward<KeyType>(key));
+    buffer._fill_();
+    return buffer;
   }
 
   template<typename MatrixType>
@@ -106,7 +103,7 @@ protected:
   static void create_buffers(bool bc_strategy_id, ArgType& args, CommType&& CommInfo){
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY); auto aggregDim = index_pair.first*CommInfo.d;
     init(args.base_case_table, index_pair, nullptr,index_pair.first,index_pair.second,CommInfo.d,CommInfo.d);
-    auto num_elems = args.base_case_table[index_pair].num_elems()*CommInfo.d*CommInfo.d;
+    auto num_elems = args.base_case_table.at(index_pair).num_elems()*CommInfo.d*CommInfo.d;
     if (bc_strategy_id==0){
       init(args.base_case_cyclic_table, index_pair, nullptr,aggregDim,aggregDim,CommInfo.d,CommInfo.d);
       init(args.base_case_blocked_table,index_pair, num_elems);
@@ -148,9 +145,9 @@ protected:
   template<typename ArgType, typename CommType>
   static void remove_buffers(bool bc_strategy_id, ArgType& args, CommType&& CommInfo){
     auto index_pair = std::make_pair(args.AendX-args.AstartX,args.AendY-args.AstartY);
-    flush(args.base_case_table[index_pair]);
+    flush(args.base_case_table.at(index_pair));
     if (bc_strategy_id<=1){
-      flush(args.base_case_cyclic_table[index_pair]);
+      flush(args.base_case_cyclic_table.at(index_pair));
     }
   }
 };
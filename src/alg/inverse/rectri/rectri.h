@@ -28,10 +28,12 @@ public:
     matrix<ScalarType,DimensionType,typename SerializePolicy::structure> L;
     matrix<ScalarType,DimensionType,typename SerializePolicy::structure> Linv;
     // Optimizing members
-    std::map<int,matrix<ScalarType,DimensionType,rect>> L_panel_table;
-    std::map<int,matrix<ScalarType,DimensionType,rect>> L_block_table;
-    std::map<int,matrix<ScalarType,DimensionType,rect>> Linv_panel_table;
-    std::map<int,matrix<ScalarType,DimensionType,rect>> Linv_block_table;
+    workspace<int,matrix<ScalarType,DimensionType,rect>> L_panel_table;
+    workspace<int,matrix<ScalarType,DimensionType,rect>> L_block_table;
+    workspace<int,matrix<ScalarType,DimensionType,rect>> Linv_panel_table;
+    workspace<int,matrix<ScalarType,DimensionType,rect>> Linv_block_table;
+    // invoke refills the workspaces above (indexed by level) and seals them before inverting
+    void seal(bool sealed){ L_panel_table.seal(sealed); L_block_table.seal(sealed); Linv_panel_table.seal(sealed); Linv_block_table.seal(sealed); }
     int num_levels;
     std::vector<topo::square> process_grids;
     std::vector<MPI_Comm> swap_communicators;
@@ -8,11 +8,13 @@ void rectri<SerializePolicy,IntermediatesPolicy>::invoke(const MatrixType& A, Ar
   auto localDimension = A.num_rows_local(); auto globalDimension = A.num_rows_global();
 //  args.L._register_(A.num_columns_global(),A.num_rows_global(),CommInfo.d,CommInfo.d);
 //  args.Linv._register_(A.num_columns_global(),A.num_rows_global(),CommInfo.d,CommInfo.d);
-  args.L_block_table[0] = decltype(args.L)(A.num_columns_global(),A.num_rows_global(),CommInfo.d,CommInfo.d);
-  args.Linv_block_table[0] = decltype(args.L)(A.num_columns_global(),A.num_rows_global(),CommInfo.d,CommInfo.d);
+  args.L_panel_table.clear(); args.L_block_table.clear(); args.Linv_panel_table.clear(); args.Linv_block_table.clear();
+  args.L_block_table.emplace(0,A.num_columns_global(),A.num_rows_global(),CommInfo.d,CommInfo.d);
+  args.Linv_block_table.emplace(0,A.num_columns_global(),A.num_rows_global(),CommInfo.d,CommInfo.d);
   serialize<lowertri,lowertri>::invoke(A,args.L_block_table[0],0,localDimension,0,localDimension,0,localDimension,0,localDimension);
   args.num_levels=0;
   simulate(args, std::forward<CommType>(CommInfo));
+  args.seal(true);
   invert(args, std::forward<CommType>(CommInfo));
 }
 
@@ -39,12 +41,12 @@ void rectri<SerializePolicy,IntermediatesPolicy>::simulate(ArgType& args, CommTy
   MPI_Comm_split(CommInfo.world,swap_color,CommInfo.rank,&swap_comm);		// key might be wrong
   MPI_Comm_split(CommInfo.world,recurse_color,CommInfo.rank,&recurse_comm);	// key might be wrong
   args.swap_communicators.push_back(swap_comm);
-  args.L_panel_table[args.num_levels-1] = decltype(args.L)(args.L_block_table[args.num_levels-1].num_columns_global()/8,args.L_block_table[args.num_levels-1].num_rows_global(),CommInfo.d/2,CommInfo.d/2);
-  args.Linv_panel_table[args.num_levels-1] = decltype(args.L)(args.L_block_table[args.num_levels-1].num_columns_global()/8,args.L_block_table[args.num_levels-1].num_rows_global(),CommInfo.d/2,CommInfo.d/2);
-  MPI_Alltoall(&args.L_block_table[args.num_levels-1].data()[(recurse_color<4) ? 0 : args.L_block_table[args.num_levels-1].num_elems()/2], args.L_block_table[args.num_levels-1].num_elems()/8, MPI_DOUBLE,
-               &args.L_panel_table[args.num_levels-1].scratch()[0], args.L_block_table[args.num_levels-1].num_elems()/8, MPI_DOUBLE, swap_comm);
-  args.L_block_table[args.num_levels] = decltype(args.L)(args.L_block_table[args.num_levels-1].num_columns_global()/8,args.L_block_table[args.num_levels-1].num_rows_global()/8,CommInfo.d/2,CommInfo.d/2);
-  args.Linv_block_table[args.num_levels] = decltype(args.L)(args.L_block_table[args.num_levels-1].num_columns_global()/8,args.L_block_table[args.num_levels-1].num_rows_global()/8,CommInfo.d/2,CommInfo.d/2);
+  args.L_panel_table.emplace(args.num_levels-1,args.L_block_table[args.num_levels-1].num_columns_global()/8,args.L_block_table[args.num_levels-1].num_rows_global(),CommInfo.d/2,CommInfo.d/2);
+  args.Linv_panel_table.emplace(args.num_levels-1,args.L_block_table[args.num_levels-1].num_columns_global()/8,args.L_block_table[args.num_levels-1].num_rows_global(),CommInfo.d/2,CommInfo.d/2);
+  MPI_Alltoall(&args.L_block_table[args.num_levels-1].data()[(recurse_color<4) ? 0 : args.L_block_table[args.num_levels-1].num_elems()/2], args.L_block_table[args.num_levels-1].num_elems()/8, mpi_type<typename decltype(args.L)::ScalarType>::type,
+               &args.L_panel_table[args.num_levels-1].scratch()[0], args.L_block_table[args.num_levels-1].num_elems()/8, mpi_type<typename decltype(args.L)::ScalarType>::type, swap_comm);
+  args.L_block_table.emplace(args.num_levels,args.L_block_table[args.num_levels-1].num_columns_global()/8,args.L_block_table[args.num_levels-1].num_rows_global()/8,CommInfo.d/2,CommInfo.d/2);
+  args.Linv_block_table.emplace(args.num_levels,args.L_block_table[args.num_levels-1].num_columns_global()/8,args.L_block_table[args.num_levels-1].num_rows_global()/8,CommInfo.d/2,CommInfo.d/2);
   int64_t blocked_offset = args.L_block_table[args.num_levels-1].num_elems()/8;
   std::array<int,4> counters; counters.fill(0.0); std::array<int,2> offsets; offsets[0]=0; offsets[1]=2*blocked_offset;
   int num_rows_local = args.L_panel_table[args.num_levels-1].num_rows_local(); int num_columns_local = args.L_panel_table[args.num_levels-1].num_columns_local();
@@ -0,0 +1,42 @@
+/* Author: Edward Hutter */
+
+#ifndef MATMULT__CANNON25D_H_
+#define MATMULT__CANNON25D_H_
+
+#include "./../../alg.h"
+#include "./../summa/summa.h"
+
+namespace matmult{
+/*
+  2.5D matrix multiplication by Cannon's shifts on a topo::square grid, an alternative multiply engine to summa.
+  Each of the c layers starts from a different skew, so that its d/c shift steps cover a distinct 1/c of K, and C is then reduced along depth.
+  Operands move point-to-point between neighbors, with the next step's blocks in flight while the current ones are multiplied,
+    rather than being broadcast along rows and columns.
+  Only gemm is implemented by shifting. The trmm and syrk interfaces (and transposed gemms) forward to summa, so that cannon25d
+    can stand in for summa wherever a multiply engine is a template policy (e.g. cholesky::cholinv, qr::cacqr).
+*/
+
+class cannon25d{
+public:
+  // Format: matrixA is M x K
+  //         matrixB is K x N
+  //         matrixC is M x N
+  // Requires rect, non-view operands and c to divide d.
+  template<typename MatrixAType, typename MatrixBType, typename MatrixCType, typename CommType>
+  static void invoke(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage);
+
+  // summa fallbacks: no skew is implemented for trmm or syrk.
+  template<typename MatrixAType, typename MatrixBType, typename CommType>
+  static void invoke(MatrixAType& A, MatrixBType& B, CommType&& CommInfo, blas::ArgPack_trmm<typename MatrixAType::ScalarType>& srcPackage);
+
+  template<typename MatrixSrcType, typename MatrixDestType, typename CommType>
+  static void invoke(MatrixSrcType& A, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage);
+
+  template<typename MatrixSrcType, typename MatrixTransType, typename MatrixDestType, typename CommType>
+  static void invoke(MatrixSrcType& A, MatrixTransType& B, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage);
+};
+}
+
+#include "cannon25d.hpp"
+
+#endif /* MATMULT__CANNON25D_H_ */
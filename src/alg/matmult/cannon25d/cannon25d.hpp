@@ -0,0 +1,68 @@
+/* Author: Edward Hutter */
+
+namespace matmult{
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType, typename CommType>
+void cannon25d::invoke(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage){
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_START(Cannon25d::invoke);
+#endif
+  using T = typename MatrixAType::ScalarType;
+  static_assert(std::is_same<typename MatrixAType::StructureType,rect>::value && std::is_same<typename MatrixBType::StructureType,rect>::value && std::is_same<typename MatrixCType::StructureType,rect>::value &&
+                !is_matrix_view<MatrixAType>::value && !is_matrix_view<MatrixBType>::value && !is_matrix_view<MatrixCType>::value,"cannon25d requires rect matrices");
+  // The shifts below pair block columns of A with block rows of B, which a transposed operand does not provide
+  if (srcPackage.transposeA != blas::Transpose::AblasNoTrans || srcPackage.transposeB != blas::Transpose::AblasNoTrans){
+    summa::invoke(A,B,C,std::forward<CommType>(CommInfo),srcPackage);
+  }
+  else{
+    assert(CommInfo.d % CommInfo.c == 0);
+    int64_t d = CommInfo.d; int64_t steps = CommInfo.d/CommInfo.c; int64_t x = CommInfo.x; int64_t y = CommInfo.y;
+    int64_t offset = CommInfo.z*steps;	// the first block column of A (block row of B) this layer multiplies, relative to Cannon's skew
+    auto localDimensionM = A.num_rows_local(); auto localDimensionN = B.num_columns_local(); auto localDimensionK = A.num_columns_local();
+    auto sizeA = A.num_elems(); auto sizeB = B.num_elems();
+
+    // Skew: process (x,y) starts with A's block column (and B's block row) x+y+offset
+    T* currentA = A.scratch(); T* nextA = A.pad(); T* currentB = B.scratch(); T* nextB = B.pad();
+    MPI_Sendrecv(A.data(), sizeA, mpi_type<T>::type, ((x-y-offset)%d+d)%d, 0, currentA, sizeA, mpi_type<T>::type, (x+y+offset)%d, 0, CommInfo.row, MPI_STATUS_IGNORE);
+    MPI_Sendrecv(B.data(), sizeB, mpi_type<T>::type, ((y-x-offset)%d+d)%d, 0, currentB, sizeB, mpi_type<T>::type, (x+y+offset)%d, 0, CommInfo.column, MPI_STATUS_IGNORE);
+
+    // Beta is applied on one layer, as in summa, so that the reduction along depth yields the result directly
+    blas::ArgPack_gemm<T> gemmPack(srcPackage.order, srcPackage.transposeA, srcPackage.transposeB, srcPackage.alpha, (CommInfo.z == 0 ? srcPackage.beta : T(0)));
+    MPI_Request requests[4];
+    for (int64_t step=0; step<steps; step++){
+      bool shift = (step+1 < steps);
+      if (shift){
+        MPI_Irecv(nextA, sizeA, mpi_type<T>::type, (x+1)%d, 1, CommInfo.row, &requests[0]);
+        MPI_Irecv(nextB, sizeB, mpi_type<T>::type, (y+1)%d, 1, CommInfo.column, &requests[1]);
+        MPI_Isend(currentA, sizeA, mpi_type<T>::type, (x+d-1)%d, 1, CommInfo.row, &requests[2]);
+        MPI_Isend(currentB, sizeB, mpi_type<T>::type, (y+d-1)%d, 1, CommInfo.column, &requests[3]);
+      }
+      blas::engine::_gemm(currentA, currentB, C.data(), localDimensionM, localDimensionN, localDimensionK, localDimensionM, localDimensionK, localDimensionM, gemmPack);
+      gemmPack.beta = 1.;
+      if (shift){
+        MPI_Waitall(4, &requests[0], MPI_STATUSES_IGNORE);
+        std::swap(currentA,nextA); std::swap(currentB,nextB);
+      }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, C.data(), C.num_elems(), mpi_type<T>::type, MPI_SUM, CommInfo.depth);
+  }
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_STOP(Cannon25d::invoke);
+#endif
+}
+
+template<typename MatrixAType, typename MatrixBType, typename CommType>
+void cannon25d::invoke(MatrixAType& A, MatrixBType& B, CommType&& CommInfo, blas::ArgPack_trmm<typename MatrixAType::ScalarType>& srcPackage){
+  summa::invoke(A,B,std::forward<CommType>(CommInfo),srcPackage);
+}
+
+template<typename MatrixSrcType, typename MatrixDestType, typename CommType>
+void cannon25d::invoke(MatrixSrcType& A, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage){
+  summa::invoke(A,C,std::forward<CommType>(CommInfo),srcPackage);
+}
+
+template<typename MatrixSrcType, typename MatrixTransType, typename MatrixDestType, typename CommType>
+void cannon25d::invoke(MatrixSrcType& A, MatrixTransType& B, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage){
+  summa::invoke(A,B,C,std::forward<CommType>(CommInfo),srcPackage);
+}
+}
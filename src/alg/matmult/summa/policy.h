@@ -0,0 +1,74 @@
+#ifndef MATMULT__POLICY__SUMMA
+#define MATMULT__POLICY__SUMMA
+
+namespace matmult{
+namespace policy{
+namespace summa{
+
+// Wire formats for the operands summa broadcasts and the products it reduces along depth.
+//   A compressed format rounds each (real) component to wire_type for the transfer only: roots keep their own blocks, the local gemm
+//   runs in the matrices' scalar type, and reductions reduce-scatter the layers' compressed contributions, sum each segment in that type,
+//   and allgather the compressed segment sums.
+
+// ***********************************************************************************************************************************************************************
+class NativeWire{
+public:
+  static constexpr bool compressed = false;
+};
+
+// ***********************************************************************************************************************************************************************
+class FloatWire{
+public:
+  static constexpr bool compressed = true;
+  using wire_type = float;
+  static MPI_Datatype type(){ return MPI_FLOAT; }
+
+  template<typename RealType>
+  static void encode(const RealType* src, wire_type* dest, int64_t n){
+    for (int64_t i=0; i<n; i++){ dest[i] = static_cast<wire_type>(src[i]); }
+  }
+  template<typename RealType>
+  static void decode(const wire_type* src, RealType* dest, int64_t n){
+    for (int64_t i=0; i<n; i++){ dest[i] = static_cast<RealType>(src[i]); }
+  }
+};
+
+// ***********************************************************************************************************************************************************************
+// bfloat16: the upper half of an IEEE single, rounded to nearest even
+class BFloat16Wire{
+public:
+  static constexpr bool compressed = true;
+  using wire_type = uint16_t;
+  static MPI_Datatype type(){ return MPI_UINT16_T; }
+
+  template<typename RealType>
+  static void encode(const RealType* src, wire_type* dest, int64_t n){
+    for (int64_t i=0; i<n; i++){
+      float val = static_cast<float>(src[i]); uint32_t bits; std::memcpy(&bits, &val, sizeof(bits));
+      dest[i] = static_cast<wire_type>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+    }
+  }
+  template<typename RealType>
+  static void decode(const wire_type* src, RealType* dest, int64_t n){
+    for (int64_t i=0; i<n; i++){
+      uint32_t bits = static_cast<uint32_t>(src[i]) << 16; float val; std::memcpy(&val, &bits, sizeof(val));
+      dest[i] = static_cast<RealType>(val);
+    }
+  }
+};
+
+// ***********************************************************************************************************************************************************************
+// Bytes this process has sent through compressed collectives (a broadcast counted as its payload, a reduction as what its reduce-scatter
+//   and allgather send), and what the same transfers would have sent at full precision
+class WireStats{
+public:
+  static size_t& native_bytes(){ static size_t bytes = 0; return bytes; }
+  static size_t& wire_bytes(){ static size_t bytes = 0; return bytes; }
+  static double reduction(){ return wire_bytes() == 0 ? 1. : static_cast<double>(native_bytes())/wire_bytes(); }
+  static void reset(){ native_bytes() = 0; wire_bytes() = 0; }
+};
+}
+}
+}
+
+#endif /* MATMULT__POLICY__SUMMA */
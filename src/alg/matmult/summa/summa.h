@@ -4,6 +4,7 @@
 #define MATMULT__SUMMA_H_
 
 #include "./../../alg.h"
+#include "./policy.h"
 
 namespace matmult{
 /*
@@ -21,28 +22,150 @@ public:
   // New design: user will specify via an argument to the overloaded Multiply() method what underlying BLAS routine he wants called.
   //             I think this is a reasonable assumption to make and will allow me to optimize each routine.
 
-  template<typename MatrixAType, typename MatrixBType, typename MatrixCType, typename CommType>
-  static void invoke(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage);
+  // Where the reduction along the depth dimension leaves C: replicated on every layer, or scattered so that each layer
+  //   holds only its own segment of the local block (see segment) until a later allgather (or never, if the caller only needs its share)
+  enum class Collect { Replicate, Scatter };
+
+  // WirePolicy (see policy.h) selects the format A,B and C travel in, e.g. invoke<policy::summa::BFloat16Wire>(A,B,C,CommInfo,srcPackage).
+  //   A compressed format broadcasts and reduces whole blocks, so it disables chunking and pipelining, and Collect::Scatter reduces natively.
+  template<typename WirePolicy = policy::summa::NativeWire, typename MatrixAType, typename MatrixBType, typename MatrixCType, typename CommType>
+  static void invoke(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage, Collect mode = Collect::Replicate);
+
+  // gemm on a topo::cuboid grid: each layer gathers the blocks of A and B for its share of K, multiplies them, and C is reduced along depth.
+  //   A is distributed over a pm x (pn*pk) grid at (y, x*pk+z), B over a (pm*pk) x pn grid at (y*pk+z, x), and C over pm x pn at (y,x) on every layer.
+  //   Requires rect, non-view, non-transposed operands.
+  template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+  static void invoke(MatrixAType& A, MatrixBType& B, MatrixCType& C, topo::cuboid& CommInfo, blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage);
 
   template<typename MatrixAType, typename MatrixBType, typename CommType>
   static void invoke(MatrixAType& A, MatrixBType& B, CommType&& CommInfo, blas::ArgPack_trmm<typename MatrixAType::ScalarType>& srcPackage);
 
   template<typename MatrixSrcType, typename MatrixDestType, typename CommType>
-  static void invoke(MatrixSrcType& A, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage);
+  static void invoke(MatrixSrcType& A, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage, Collect mode = Collect::Replicate);
 
-  template<typename MatrixSrcType, typename MatrixDestType, typename CommType>
-  static void invoke(MatrixSrcType& A, MatrixSrcType& B, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage);
+  template<typename MatrixSrcType, typename MatrixTransType, typename MatrixDestType, typename CommType>
+  static void invoke(MatrixSrcType& A, MatrixTransType& B, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage, Collect mode = Collect::Replicate);
+
+  // A gemm that is repeated with the same shapes, buffers and communicators (e.g. on SaveIntermediates' table entries).
+  //   Its collectives are set up once, as MPI-4 persistent collectives where available, so execute() only starts and completes them.
+  //   The operands must be rect matrices that are neither reallocated nor swapped for the lifetime of the plan.
+  template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+  class plan{
+  public:
+    using ScalarType = typename MatrixAType::ScalarType;
+    template<typename CommType>
+    plan(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, const blas::ArgPack_gemm<ScalarType>& srcPackage);
+    plan(const plan& p) = delete;
+    plan(plan&& p);
+    plan& operator=(const plan& p) = delete;
+    plan& operator=(plan&& p) = delete;
+    ~plan();
+    void execute();
+  private:
+    MatrixAType& A; MatrixBType& B; MatrixCType& C;
+    blas::ArgPack_gemm<ScalarType> pack;
+    ScalarType* bufferA; ScalarType* bufferB; ScalarType* bufferC;	// the roots broadcast straight from their data, and C is reduced in place
+    int64_t localDimensionM,localDimensionN,localDimensionK;
+    int root; MPI_Comm row,column,depth;
+    MPI_Request requests[3];
+  };
+
+  template<typename MatrixAType, typename MatrixBType, typename MatrixCType, typename CommType>
+  static plan<MatrixAType,MatrixBType,MatrixCType> make_plan(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, const blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage);
+
+  // A gemm started by iinvoke and still in flight: A,B are broadcast and C reduced by nonblocking collectives, and the local gemm runs in between,
+  //   from whichever of test() or wait() first finds the broadcasts complete. The operands must be left untouched until the handle completes
+  //   (test() returns true, or wait() or the destructor returns). Takes the same operands as plan.
+  template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+  class handle{
+  public:
+    using ScalarType = typename MatrixAType::ScalarType;
+    template<typename CommType>
+    handle(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, const blas::ArgPack_gemm<ScalarType>& srcPackage);
+    handle(const handle& h) = delete;
+    handle(handle&& h);
+    handle& operator=(const handle& h) = delete;
+    handle& operator=(handle&& h) = delete;
+    ~handle();
+    bool test();
+    void wait();
+  private:
+    void multiply();
+    MatrixAType& A; MatrixBType& B; MatrixCType& C;
+    blas::ArgPack_gemm<ScalarType> pack;
+    ScalarType* bufferA; ScalarType* bufferB;
+    int64_t localDimensionM,localDimensionN,localDimensionK;
+    MPI_Comm depth;
+    MPI_Request requests[3];
+    int stage;	// 0: broadcasting A,B, 1: reducing C, 2: complete
+  };
+
+  template<typename MatrixAType, typename MatrixBType, typename MatrixCType, typename CommType>
+  static handle<MatrixAType,MatrixBType,MatrixCType> iinvoke(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, const blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage);
+
+  // Completes a C left scattered along depth by Collect::Scatter
+  template<typename MatrixType, typename CommType>
+  static void allgather(MatrixType& matrix, CommType&& CommInfo);
+
+  // The [first,first+second) range of the local block's elements that this process' layer holds after Collect::Scatter
+  template<typename MatrixType, typename CommType>
+  static std::pair<int64_t,int64_t> segment(const MatrixType& matrix, CommType&& CommInfo);
 
 private:
 
-  template<typename MatrixAType, typename MatrixBType, typename CommType>
+  template<typename WirePolicy = policy::summa::NativeWire, typename MatrixAType, typename MatrixBType, typename CommType>
   static void distribute(MatrixAType& A, MatrixBType& B, CommType&& CommInfo);
 
-  template<typename MatrixType, typename CommType>
-  static void collect(MatrixType& matrix, CommType&& CommInfo);
+  template<typename WirePolicy = policy::summa::NativeWire, typename MatrixType, typename CommType>
+  static void collect(MatrixType& matrix, CommType&& CommInfo, Collect mode = Collect::Replicate);
 
-  template<typename MatrixSrcType, typename MatrixDestType, typename CommType>
-  static void syrk_internal(MatrixSrcType& A, MatrixSrcType& B, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage);
+  // Broadcasts A,B in CommInfo.num_chunks panels along K and multiplies each panel as soon as it lands,
+  //   keeping up to CommInfo.pipeline_depth later panels in flight. Requires rect operands.
+  template<typename MatrixAType, typename MatrixBType, typename MatrixCType, typename CommType>
+  static void pipeline(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage);
+
+  template<typename MatrixType>
+  static void ibcast_panel(MatrixType& matrix, bool columns, int64_t start, int64_t len, int root, MPI_Comm comm, MPI_Request* request);
+
+  template<typename MatrixSrcType, typename MatrixTransType, typename MatrixDestType, typename CommType>
+  static void syrk_internal(MatrixSrcType& A, MatrixTransType& B, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage, Collect mode);
+
+  // Expands a broadcast RFP or tiled operand into its dense pad buffer, for routines that cannot consume it packed
+  template<typename MatrixType>
+  static void unpack(MatrixType& matrix);
+
+  // Helpers that let matrix views (see matrix/view.h) take part in place of matrices
+  template<typename MatrixType>
+  static void bcast(MatrixType& matrix, int root, MPI_Comm comm);
+
+  // Broadcasts the root's (already distributed) scratch of src into the scratch of dest on the other processes
+  template<typename MatrixSrcType, typename MatrixDestType>
+  static void forward(MatrixSrcType& src, MatrixDestType& dest, int root, MPI_Comm comm, bool isRoot);
+
+  // bcast, and an in-place sum, in WirePolicy's format (dispatched on WirePolicy::compressed)
+  template<typename WirePolicy, typename MatrixType>
+  static void bcast(MatrixType& matrix, int root, MPI_Comm comm, std::false_type);
+
+  template<typename WirePolicy, typename MatrixType>
+  static void bcast(MatrixType& matrix, int root, MPI_Comm comm, std::true_type);
+
+  template<typename WirePolicy, typename ScalarType>
+  static void allreduce(ScalarType* buffer, int64_t count, MPI_Comm comm, std::false_type);
+
+  template<typename WirePolicy, typename ScalarType>
+  static void allreduce(ScalarType* buffer, int64_t count, MPI_Comm comm, std::true_type);
+
+  template<typename MatrixType>
+  static void stage(MatrixType& matrix){}
+
+  template<typename ScalarType, typename DimensionType>
+  static void stage(matrix_view<ScalarType,DimensionType>& matrix);
+
+  template<typename MatrixType, typename ScalarType>
+  static void accumulate(MatrixType& matrix, ScalarType beta);
+
+  template<typename ScalarType, typename DimensionType>
+  static void accumulate(matrix_view<ScalarType,DimensionType>& matrix, ScalarType beta);
 };
 }
 
@@ -3,15 +3,19 @@
 namespace matmult{
 
 // Invariant: it is assumed that the matrix data is stored in the _data member, and the _scratch member is available for exploiting
-template<typename MatrixAType, typename MatrixBType, typename MatrixCType, typename CommType>
-void summa::invoke(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage){
+template<typename WirePolicy, typename MatrixAType, typename MatrixBType, typename MatrixCType, typename CommType>
+void summa::invoke(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage, Collect mode){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(Summa::invoke);
 #endif
   // Use tuples so we don't have to pass multiple things by reference.
   // Also this way, we can take advantage of the new pass-by-value move semantics that are efficient
   using T = typename MatrixAType::ScalarType;
-  using StructureA = typename MatrixAType::StructureType; using StructureB = typename MatrixBType::StructureType;
+  using StructureA = typename MatrixAType::StructureType; using StructureB = typename MatrixBType::StructureType; using StructureC = typename MatrixCType::StructureType;
+  // Operands sharing one tile-major layout are multiplied tile by tile, without unpacking into their dense pads
+  constexpr bool tiledGemm = is_tiled<StructureA>::value && is_tiled<StructureB>::value && is_tiled<StructureC>::value &&
+                             is_tiled<StructureA>::tile_dimension == is_tiled<StructureB>::tile_dimension && is_tiled<StructureA>::tile_dimension == is_tiled<StructureC>::tile_dimension;
+  static_assert(!is_tiled<StructureC>::value || tiledGemm,"gemm writes into a tiled matrix only when both operands share its tiling");
 
   bool isRootRow = ((CommInfo.x == CommInfo.z) ? true : false);
   bool isRootColumn = ((CommInfo.y == CommInfo.z) ? true : false);
@@ -20,29 +24,75 @@ void summa::invoke(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& Co
   auto localDimensionN = (srcPackage.transposeB == blas::Transpose::AblasNoTrans ? B.num_columns_local() : B.num_rows_local());
   auto localDimensionK = (srcPackage.transposeA == blas::Transpose::AblasNoTrans ? A.num_columns_local() : A.num_rows_local());
 
+  constexpr bool pipelinable = std::is_same<StructureA,rect>::value && std::is_same<StructureB,rect>::value && !is_matrix_view<MatrixAType>::value && !is_matrix_view<MatrixBType>::value;
+  bool pipelined = pipelinable && !WirePolicy::compressed && (CommInfo.num_chunks > 0) && (CommInfo.pipeline_depth > 0);
+
   // Communicated data lives in the _scratch members of A,B
-  distribute(A,B,std::forward<CommType>(CommInfo));
+  if (!pipelined){ distribute<WirePolicy>(A,B,std::forward<CommType>(CommInfo)); }
+  if (!tiledGemm){ unpack(A); unpack(B); }
 
   // Assume, for now, that C has Rectangular Structure. In the future, we can always do the same procedure as above, and add a invoke after the AllReduce
-  decltype(srcPackage.beta) save_beta = srcPackage.beta; srcPackage.beta = 0;
-  blas::engine::_gemm(A.scratch(), B.scratch(), C.scratch(), localDimensionM, localDimensionN, localDimensionK,
-                      (srcPackage.transposeA == blas::Transpose::AblasNoTrans ? localDimensionM : localDimensionK),
-                      (srcPackage.transposeB == blas::Transpose::AblasNoTrans ? localDimensionK : localDimensionN), localDimensionM, srcPackage);
-  collect(C,std::forward<CommType>(CommInfo));
-  if (save_beta != 0){
-    for (auto i=0; i<C.num_elems(); i++){ C.data()[i] = save_beta*C.data()[i] + C.scratch()[i]; }
-  }
-  else{ C.swap(); }
+  // Beta is applied by the local gemm on one layer (with C swapped into scratch), so that the reduction along depth yields the result directly.
+  //   Views keep their strided data apart from their contiguous scratch, and so still accumulate afterwards, as does a compressed wire,
+  //   which would otherwise round beta*C to wire_type along with the layers' contributions.
+  constexpr bool fuseBeta = !is_matrix_view<MatrixCType>::value && !WirePolicy::compressed;
+  decltype(srcPackage.beta) save_beta = srcPackage.beta; srcPackage.beta = (fuseBeta && CommInfo.z == 0 ? save_beta : 0);
+  if (fuseBeta){ C.swap(); }
+  if (pipelined){ pipeline(A,B,C,std::forward<CommType>(CommInfo),srcPackage); }
+  else if (tiledGemm){
+    blas::engine::_gemm_tiled(A.scratch(), B.scratch(), C.scratch(), localDimensionM, localDimensionN, localDimensionK, is_tiled<StructureC>::tile_dimension, srcPackage);
+  }
+  else{
+    blas::engine::_gemm(A.scratch(), B.scratch(), C.scratch(), localDimensionM, localDimensionN, localDimensionK,
+                        A.leading_dimension(1), B.leading_dimension(1), C.leading_dimension(1), srcPackage);
+  }
+  collect<WirePolicy>(C,std::forward<CommType>(CommInfo),mode);
+  if (fuseBeta){ C.swap(); } else{ accumulate(C,save_beta); }
   // Reset before returning
   srcPackage.beta = save_beta;
-  if (!std::is_same<StructureA,rect>::value){ A.swap_pad(); }
-  if (!std::is_same<StructureB,rect>::value){ B.swap_pad(); }
+  if (!std::is_same<StructureA,rect>::value && !tiledGemm){ A.swap_pad(); }
+  if (!std::is_same<StructureB,rect>::value && !tiledGemm){ B.swap_pad(); }
   if (isRootRow){ A.swap(); } if (isRootColumn){ B.swap(); }
 #ifdef FUNCTION_SYMBOLS
   CRITTER_STOP(Summa::invoke);
 #endif
 }
   
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+void summa::invoke(MatrixAType& A, MatrixBType& B, MatrixCType& C, topo::cuboid& CommInfo, blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage){
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_START(Summa::invoke);
+#endif
+  using T = typename MatrixAType::ScalarType;
+  static_assert(std::is_same<typename MatrixAType::StructureType,rect>::value && std::is_same<typename MatrixBType::StructureType,rect>::value && std::is_same<typename MatrixCType::StructureType,rect>::value &&
+                !is_matrix_view<MatrixAType>::value && !is_matrix_view<MatrixBType>::value && !is_matrix_view<MatrixCType>::value,"summa's cuboid gemm requires rect matrices");
+  assert(srcPackage.transposeA == blas::Transpose::AblasNoTrans && srcPackage.transposeB == blas::Transpose::AblasNoTrans);
+  auto localDimensionM = A.num_rows_local(); auto localDimensionN = B.num_columns_local();
+  auto localDimensionK = A.num_columns_local()*CommInfo.pn;	// the K indices congruent to z modulo pk, which B shares as B.num_rows_local()*CommInfo.pm
+
+  // The gathers interleave the pieces straight into the layer's (cyclic) K order: piece x supplies every pn-th column of A starting at x,
+  //   and piece y every pm-th row of B starting at y.
+  std::vector<T> bufferA(localDimensionM*localDimensionK), bufferB(localDimensionK*localDimensionN);
+  MPI_Datatype columnsA, rowsB, pieceA, pieceB;
+  MPI_Type_vector(A.num_columns_local(), localDimensionM, CommInfo.pn*localDimensionM, mpi_type<T>::type, &columnsA);
+  MPI_Type_create_resized(columnsA, 0, localDimensionM*sizeof(T), &pieceA);
+  MPI_Type_vector(B.num_rows_local()*localDimensionN, 1, CommInfo.pm, mpi_type<T>::type, &rowsB);
+  MPI_Type_create_resized(rowsB, 0, sizeof(T), &pieceB);
+  MPI_Type_commit(&pieceA); MPI_Type_commit(&pieceB);
+  MPI_Allgather(A.data(), A.num_elems(), mpi_type<T>::type, &bufferA[0], 1, pieceA, CommInfo.row);
+  MPI_Allgather(B.data(), B.num_elems(), mpi_type<T>::type, &bufferB[0], 1, pieceB, CommInfo.column);
+  MPI_Type_free(&pieceA); MPI_Type_free(&pieceB); MPI_Type_free(&columnsA); MPI_Type_free(&rowsB);
+
+  // Beta is applied on one layer, as in the square gemm, so that the reduction along depth yields the result directly
+  decltype(srcPackage.beta) save_beta = srcPackage.beta; srcPackage.beta = (CommInfo.z == 0 ? save_beta : 0);
+  blas::engine::_gemm(&bufferA[0], &bufferB[0], C.data(), localDimensionM, localDimensionN, localDimensionK, localDimensionM, localDimensionK, localDimensionM, srcPackage);
+  srcPackage.beta = save_beta;
+  MPI_Allreduce(MPI_IN_PLACE, C.data(), C.num_elems(), mpi_type<T>::type, MPI_SUM, CommInfo.depth);
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_STOP(Summa::invoke);
+#endif
+}
+
 template<typename MatrixAType, typename MatrixBType, typename CommType>
 void summa::invoke(MatrixAType& A, MatrixBType& B, CommType&& CommInfo, blas::ArgPack_trmm<typename MatrixAType::ScalarType>& srcPackage){
 #ifdef FUNCTION_SYMBOLS
@@ -52,6 +102,7 @@ void summa::invoke(MatrixAType& A, MatrixBType& B, CommType&& CommInfo, blas::Ar
   // Also this way, we can take advantage of the new pass-by-value move semantics that are efficient
   using T = typename MatrixAType::ScalarType;
   using StructureA = typename MatrixAType::StructureType; using StructureB = typename MatrixBType::StructureType;
+  static_assert(!std::is_same<StructureB,rfp>::value,"trmm does not yet write into an RFP matrix");
 
   bool isRootRow = ((CommInfo.x == CommInfo.z) ? true : false);
   bool isRootColumn = ((CommInfo.y == CommInfo.z) ? true : false);
@@ -61,106 +112,138 @@ void summa::invoke(MatrixAType& A, MatrixBType& B, CommType&& CommInfo, blas::Ar
   if (srcPackage.side == blas::Side::AblasLeft){
     if (isRootRow){ A.swap(); } if (isRootColumn){ B.swap(); }
     distribute(A, B, std::forward<CommType>(CommInfo));
-    blas::engine::_trmm(A.scratch(), B.scratch(), localDimensionM, localDimensionN, localDimensionM, localDimensionM, srcPackage);
+    unpack(B); if (!std::is_same<StructureA,rfp>::value){ unpack(A); }
+    if (std::is_same<StructureA,rfp>::value){ blas::engine::_trmm_rfp(A.scratch(), B.scratch(), localDimensionM, localDimensionN, B.leading_dimension(1), srcPackage); }
+    else{ blas::engine::_trmm(A.scratch(), B.scratch(), localDimensionM, localDimensionN, A.leading_dimension(1), B.leading_dimension(1), srcPackage); }
   }
   else{
     if (isRootRow){ B.swap(); } if (isRootColumn){ A.swap(); }
     distribute(B,A,std::forward<CommType>(CommInfo));
+    unpack(B); if (!std::is_same<StructureA,rfp>::value){ unpack(A); }
     if (std::is_same<StructureB,uppertri>::value){ B.swap_pad(); util::remove_triangle_local(B,CommInfo.x,CommInfo.y,CommInfo.d,'U'); B.swap_pad(); }
     if (std::is_same<StructureB,lowertri>::value){ B.swap_pad(); util::remove_triangle_local(B,CommInfo.x,CommInfo.y,CommInfo.d,'L'); B.swap_pad(); }
-    blas::engine::_trmm(A.scratch(), B.scratch(), localDimensionM, localDimensionN, localDimensionN, localDimensionM, srcPackage);
+    if (std::is_same<StructureA,rfp>::value){ blas::engine::_trmm_rfp(A.scratch(), B.scratch(), localDimensionM, localDimensionN, B.leading_dimension(1), srcPackage); }
+    else{ blas::engine::_trmm(A.scratch(), B.scratch(), localDimensionM, localDimensionN, A.leading_dimension(1), B.leading_dimension(1), srcPackage); }
   }
   // We will follow the standard here: A is always the triangular matrix. B is always the rectangular matrix
-  if (!std::is_same<StructureB,rect>::value){ B.swap_pad(); serialize<StructureB,StructureB>::invoke(B,B,0,localDimensionN,0,localDimensionN,0,localDimensionN,0,localDimensionN,2,1); }
+  if (!std::is_same<StructureB,rect>::value){ B.swap_pad(); serialize<StructureB,StructureB>::invoke(B,B,0,localDimensionN,0,localDimensionM,0,localDimensionN,0,localDimensionM,2,1); }
+  stage(B);
   collect(B,std::forward<CommType>(CommInfo));
   // Reset before returning
-  if (!std::is_same<StructureA,rect>::value){ A.swap_pad(); }
+  if (!std::is_same<StructureA,rect>::value && !std::is_same<StructureA,rfp>::value){ A.swap_pad(); }
   if (isRootRow && srcPackage.side == blas::Side::AblasLeft){ A.swap(); }
-  B.swap();	// unconditional swap, since B holds output
+  if (isRootColumn && srcPackage.side == blas::Side::AblasRight){ A.swap(); }
+  accumulate(B,T(0));	// unconditional, since B holds output
 #ifdef FUNCTION_SYMBOLS
   CRITTER_STOP(Summa::invoke);
 #endif
 }
 
 template<typename MatrixSrcType, typename MatrixDestType, typename CommType>
-void summa::invoke(MatrixSrcType& A, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage){
+void summa::invoke(MatrixSrcType& A, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage, Collect mode){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(Summa::invoke);
 #endif
   // No choice but to incur the copy cost below.
-  MatrixSrcType B = A; util::transpose(B, std::forward<CommType>(CommInfo));
-  syrk_internal(A,B,C,std::forward<CommType>(CommInfo),srcPackage);
+  MatrixSrcType B = A;
+  syrk_internal(A,B,C,std::forward<CommType>(CommInfo),srcPackage,mode);
 #ifdef FUNCTION_SYMBOLS
   CRITTER_STOP(Summa::invoke);
 #endif
 }
 
-template<typename MatrixSrcType, typename MatrixDestType, typename CommType>
-void summa::invoke(MatrixSrcType& A, MatrixSrcType& B, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage){
+template<typename MatrixSrcType, typename MatrixTransType, typename MatrixDestType, typename CommType>
+void summa::invoke(MatrixSrcType& A, MatrixTransType& B, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage, Collect mode){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(Summa::invoke);
 #endif
-  util::transpose(B, std::forward<CommType>(CommInfo));
-  syrk_internal(A,B,C,std::forward<CommType>(CommInfo),srcPackage);
+  syrk_internal(A,B,C,std::forward<CommType>(CommInfo),srcPackage,mode);
 #ifdef FUNCTION_SYMBOLS
   CRITTER_STOP(Summa::invoke);
 #endif
 }
 
-template<typename MatrixSrcType, typename MatrixDestType, typename CommType>
-void summa::syrk_internal(MatrixSrcType& A, MatrixSrcType& B, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage){
+template<typename MatrixSrcType, typename MatrixTransType, typename MatrixDestType, typename CommType>
+void summa::syrk_internal(MatrixSrcType& A, MatrixTransType& B, MatrixDestType& C, CommType&& CommInfo, blas::ArgPack_syrk<typename MatrixSrcType::ScalarType>& srcPackage, Collect mode){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(Summa::syrk_int);
 #endif
-  // Note: Internally, this routine uses gemm, not syrk, as its not possible for each processor to perform local MM with symmetric matrices
-  //         given the data layout over the processor grid.
+  // Note: The routine will be C <- A^T*A or A*A^T, depending on transposeA in the srcPackage. B serves as the (contiguous) receive buffer for the second operand,
+  //         or, for packed A, holds the transpose of A.
 
   using T = typename MatrixSrcType::ScalarType;
   using StructureA = typename MatrixSrcType::StructureType; using StructureC = typename MatrixDestType::StructureType;
 
   bool isRootRow = ((CommInfo.x == CommInfo.z) ? true : false);
   bool isRootColumn = ((CommInfo.y == CommInfo.z) ? true : false);
-  // Note: The routine will be C <- BA or AB, depending on the order in the srcPackage. B will always be the transposed matrix
+  bool isDiagonal = ((CommInfo.x == CommInfo.y) ? true : false);
+  bool trans = (srcPackage.transposeA != blas::Transpose::AblasNoTrans);
   auto localDimensionN = C.num_columns_local();  // rows or columns, doesn't matter. They should be the same. C is meant to be square
-  auto localDimensionK = (srcPackage.transposeA == blas::Transpose::AblasNoTrans ? A.num_columns_local() : A.num_rows_local());
+  auto localDimensionK = (trans ? A.num_rows_local() : A.num_columns_local());
+  T *operand1, *operand2; int64_t ld1, ld2;
 
-  if (srcPackage.transposeA == blas::Transpose::AblasNoTrans){
-    if (isRootRow){ A.swap(); } if (isRootColumn){ B.swap(); }
-    distribute(A,B,std::forward<CommType>(CommInfo)); }
+  if (std::is_same<StructureA,rect>::value){
+    // The block of A that C's columns need arrives by the usual broadcast. The block its rows need is the one the diagonal process of the slice's
+    //   row (or column) just received, so it is forwarded from there rather than obtained by first transposing A across the slice.
+    if (trans){ if (isRootColumn){ A.swap(); } bcast(A, CommInfo.z, CommInfo.column); }
+    else{ if (isRootRow){ A.swap(); } bcast(A, CommInfo.z, CommInfo.row); }
+    forward(A, B, (trans ? CommInfo.y : CommInfo.x), (trans ? CommInfo.row : CommInfo.column), isDiagonal);
+    operand1 = (isDiagonal ? A.scratch() : B.scratch()); ld1 = (isDiagonal ? A.leading_dimension(1) : A.num_rows_local());
+    operand2 = A.scratch(); ld2 = A.leading_dimension(1);
+    if (!trans){ std::swap(operand1,operand2); std::swap(ld1,ld2); }
+  }
   else{
-    if (isRootRow){ B.swap(); } if (isRootColumn){ A.swap(); }
-    distribute(B,A,std::forward<CommType>(CommInfo)); }
+    util::transpose(B, std::forward<CommType>(CommInfo));
+    if (!trans){
+      if (isRootRow){ A.swap(); } if (isRootColumn){ B.swap(); }
+      distribute(A,B,std::forward<CommType>(CommInfo)); }
+    else{
+      if (isRootRow){ B.swap(); } if (isRootColumn){ A.swap(); }
+      distribute(B,A,std::forward<CommType>(CommInfo)); }
+    unpack(A); unpack(B);
+    operand1 = (trans ? B.scratch() : A.scratch()); ld1 = (trans ? B.leading_dimension(1) : A.leading_dimension(1));
+    operand2 = (trans ? A.scratch() : B.scratch()); ld2 = (trans ? A.leading_dimension(1) : B.leading_dimension(1));
+  }
 
+  // A dense C takes beta in the local gemm on one layer, as in gemm. Packed structures are multiplied densely into the pad and accumulate afterwards.
+  //   Those packing only the upper triangle need only it formed: by syrk where both operands are the same block, and by a triangular gemm elsewhere.
+  constexpr bool fuseBeta = std::is_same<StructureC,rect>::value && !is_matrix_view<MatrixDestType>::value;
+  constexpr bool upperOnly = std::is_same<StructureC,uppertri>::value || std::is_same<StructureC,rfp>::value;
+  T beta = (fuseBeta && CommInfo.z == 0 ? srcPackage.beta : T(0));
   if (!std::is_same<StructureC,rect>::value) { C.swap_pad(); }
-  for (auto i=0; i<(localDimensionN*localDimensionN); i++) { C.scratch()[i] = 0.; }
-  // This cancels out any affect beta could have. Beta is just not compatable with summa and must be handled separately
-  if (srcPackage.transposeA == blas::Transpose::AblasNoTrans){
-    blas::ArgPack_gemm<T> gemmArgs(blas::Order::AblasColumnMajor, blas::Transpose::AblasNoTrans, blas::Transpose::AblasTrans, srcPackage.alpha,srcPackage.beta);
-    blas::engine::_gemm(A.scratch(), B.scratch(), C.scratch(), localDimensionN, localDimensionN, localDimensionK,
-                        localDimensionN, localDimensionN, localDimensionN, gemmArgs);
+  if (fuseBeta){ C.swap(); }
+  blas::ArgPack_gemm<T> gemmArgs(blas::Order::AblasColumnMajor, trans ? blas::Transpose::AblasTrans : blas::Transpose::AblasNoTrans,
+                                 trans ? blas::Transpose::AblasNoTrans : blas::Transpose::AblasTrans, srcPackage.alpha, beta);
+  if (upperOnly && std::is_same<StructureA,rect>::value && isDiagonal){
+    blas::ArgPack_syrk<T> syrkArgs(blas::Order::AblasColumnMajor, blas::UpLo::AblasUpper, srcPackage.transposeA, srcPackage.alpha, beta);
+    blas::engine::_syrk(operand2, C.scratch(), localDimensionN, localDimensionK, ld2, C.leading_dimension(1), syrkArgs);
+  }
+  else if (upperOnly){
+    blas::engine::_gemmt(operand1, operand2, C.scratch(), localDimensionN, localDimensionK, ld1, ld2, C.leading_dimension(1), blas::UpLo::AblasUpper, gemmArgs);
   }
   else{
-    blas::ArgPack_gemm<T> gemmArgs(blas::Order::AblasColumnMajor, blas::Transpose::AblasTrans, blas::Transpose::AblasNoTrans,srcPackage.alpha,srcPackage.beta);
-    blas::engine::_gemm(B.scratch(), A.scratch(), C.scratch(), localDimensionN, localDimensionN, localDimensionK,
-                        localDimensionK, localDimensionK, localDimensionN, gemmArgs);
+    blas::engine::_gemm(operand1, operand2, C.scratch(), localDimensionN, localDimensionN, localDimensionK, ld1, ld2, C.leading_dimension(1), gemmArgs);
   }
   if (std::is_same<StructureC,uppertri>::value) { C.swap_pad(); auto counter=0; for (auto i=0; i<localDimensionN; i++) { for (auto j=0; j<(i+1); j++) C.scratch()[counter++] = C.pad()[i*localDimensionN+j]; } }
   if (std::is_same<StructureC,lowertri>::value) { C.swap_pad(); auto counter=0; for (auto i=0; i<localDimensionN; i++) { for (auto j=0; j<(localDimensionN-i); j++) C.scratch()[counter++] = C.pad()[i*localDimensionN+j]; } }
-  collect(C,std::forward<CommType>(CommInfo));
+  if (std::is_same<StructureC,rfp>::value || is_tiled<StructureC>::value) { C.swap_pad(); serialize<StructureC,StructureC>::invoke(C,C,0,localDimensionN,0,localDimensionN,0,localDimensionN,0,localDimensionN,2,1); }
+  collect(C,std::forward<CommType>(CommInfo),mode);
 
-  if (srcPackage.beta != 0.){
-    // Future optimization: Reduce loop length by half since the update will be a symmetric matrix and only half will be used going forward.
-    for (auto i=0; i<C.num_elems(); i++){ C.data()[i] = srcPackage.beta*C.data()[i] + C.scratch()[i]; }
-  } else{ C.swap(); }
+  // Future optimization: Reduce loop length by half since the update will be a symmetric matrix and only half will be used going forward.
+  if (fuseBeta){ C.swap(); } else{ accumulate(C,srcPackage.beta); }
   // Reset before returning
-  if (!std::is_same<StructureA,rect>::value) { A.swap_pad(); }
-  if (isRootRow){ A.swap(); }
+  if (std::is_same<StructureA,rect>::value){ if (trans ? isRootColumn : isRootRow){ A.swap(); } }
+  else{
+    A.swap_pad(); B.swap_pad();
+    if (!trans){ if (isRootRow){ A.swap(); } if (isRootColumn){ B.swap(); } }
+    else{ if (isRootRow){ B.swap(); } if (isRootColumn){ A.swap(); } }
+  }
 #ifdef FUNCTION_SYMBOLS
   CRITTER_STOP(Summa::syrk_int);
 #endif
 }
 
-template<typename MatrixAType, typename MatrixBType, typename CommType>
+template<typename WirePolicy, typename MatrixAType, typename MatrixBType, typename CommType>
 void summa::distribute(MatrixAType& A, MatrixBType& B, CommType&& CommInfo){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(Summa::distribute);
@@ -174,7 +257,8 @@ void summa::distribute(MatrixAType& A, MatrixBType& B, CommType&& CommInfo){
   bool isRootColumn = ((CommInfo.y == CommInfo.z) ? true : false);
 
   // Check chunk size. If its 0, then bcast across rows and columns with no overlap
-  if (CommInfo.num_chunks == 0){
+  //   Views are always broadcast whole, as the root's strided buffer does not chunk the same way as the receivers' contiguous buffers
+  if ((CommInfo.num_chunks == 0) || WirePolicy::compressed || is_matrix_view<MatrixAType>::value || is_matrix_view<MatrixBType>::value){
     // distribute across rows
 #ifdef COLLECTIVE_CONCURRENCY_SOLO
     if (CommInfo.z==0 && CommInfo.y==0)
@@ -182,7 +266,7 @@ void summa::distribute(MatrixAType& A, MatrixBType& B, CommType&& CommInfo){
 #ifdef COLLECTIVE_CONCURRENCY_LAYER
     if (CommInfo.z==CommInfo.y)
 #endif
-    MPI_Bcast(A.scratch(), sizeA, mpi_type<T>::type, CommInfo.z, CommInfo.row);
+    bcast<WirePolicy>(A, CommInfo.z, CommInfo.row, std::integral_constant<bool,WirePolicy::compressed>());
     // distribute across columns
 #ifdef COLLECTIVE_CONCURRENCY_SOLO
     if (CommInfo.z==0 && CommInfo.x==0)
@@ -190,7 +274,7 @@ void summa::distribute(MatrixAType& A, MatrixBType& B, CommType&& CommInfo){
 #ifdef COLLECTIVE_CONCURRENCY_LAYER
     if (CommInfo.z==CommInfo.x)
 #endif
-    MPI_Bcast(B.scratch(), sizeB, mpi_type<T>::type, CommInfo.z, CommInfo.column);
+    bcast<WirePolicy>(B, CommInfo.z, CommInfo.column, std::integral_constant<bool,WirePolicy::compressed>());
   }
   else{
     // initiate distribution across rows
@@ -213,27 +297,35 @@ void summa::distribute(MatrixAType& A, MatrixBType& B, CommType&& CommInfo){
     // complete distribution along columns
     for (int64_t idx=0; idx < CommInfo.num_chunks; idx++){ MPI_Wait(&column_req[idx],&column_stat[idx]); }
   }
-  if (!std::is_same<StructureA,rect>::value){ serialize<StructureA,StructureA>::invoke(A,A,0,localDimensionK,0,localDimensionM,0,localDimensionK,0,localDimensionM,1,2); A.swap_pad(); }
-  if (!std::is_same<StructureB,rect>::value){ serialize<StructureB,StructureB>::invoke(B,B,0,localDimensionN,0,localDimensionN,0,localDimensionN,0,localDimensionN,1,2); B.swap_pad(); }
+  // RFP and tiled operands stay packed: trmm consumes RFP directly, gemm consumes matching tiles directly, and the rest unpack them on their own
+  if (!std::is_same<StructureA,rect>::value && !std::is_same<StructureA,rfp>::value && !is_tiled<StructureA>::value){ serialize<StructureA,StructureA>::invoke(A,A,0,localDimensionK,0,localDimensionM,0,localDimensionK,0,localDimensionM,1,2); A.swap_pad(); }
+  if (!std::is_same<StructureB,rect>::value && !std::is_same<StructureB,rfp>::value && !is_tiled<StructureB>::value){ serialize<StructureB,StructureB>::invoke(B,B,0,localDimensionN,0,localDimensionN,0,localDimensionN,0,localDimensionN,1,2); B.swap_pad(); }
 #ifdef FUNCTION_SYMBOLS
   CRITTER_STOP(Summa::distribute);
 #endif
 }
 
-template<typename MatrixType, typename CommType>
-void summa::collect(MatrixType& matrix, CommType&& CommInfo){
+template<typename WirePolicy, typename MatrixType, typename CommType>
+void summa::collect(MatrixType& matrix, CommType&& CommInfo, Collect mode){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(Summa::collect);
 #endif
   using T = typename MatrixType::ScalarType;
-  if (CommInfo.num_chunks == 0){
+  if (mode == Collect::Scatter){
+    // The reduced segment lands at the front of scratch, and is moved to where it lives in the local block
+    auto seg = segment(matrix,std::forward<CommType>(CommInfo)); int depth_size; MPI_Comm_size(CommInfo.depth,&depth_size);
+    std::vector<int> counts(depth_size); for (int i=0; i<depth_size; i++){ counts[i] = matrix.num_elems()/depth_size + (i < matrix.num_elems()%depth_size ? 1 : 0); }
+    MPI_Reduce_scatter(MPI_IN_PLACE, matrix.scratch(), &counts[0], mpi_type<T>::type, MPI_SUM, CommInfo.depth);
+    std::memmove(matrix.scratch()+seg.first, matrix.scratch(), sizeof(T)*seg.second);
+  }
+  else if ((CommInfo.num_chunks == 0) || WirePolicy::compressed){
 #ifdef COLLECTIVE_CONCURRENCY_SOLO
     if (CommInfo.x==0 && CommInfo.y==0)
 #endif
 #ifdef COLLECTIVE_CONCURRENCY_LAYER
     if (CommInfo.x==CommInfo.y)
 #endif
-    MPI_Allreduce(MPI_IN_PLACE,matrix.scratch(), matrix.num_elems(), mpi_type<T>::type, MPI_SUM, CommInfo.depth);
+    allreduce<WirePolicy>(matrix.scratch(), matrix.num_elems(), CommInfo.depth, std::integral_constant<bool,WirePolicy::compressed>());
   }
   else{
     // initiate collection along depth
@@ -251,4 +343,316 @@ void summa::collect(MatrixType& matrix, CommType&& CommInfo){
   CRITTER_STOP(Summa::collect);
 #endif
 }
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+template<typename CommType>
+summa::plan<MatrixAType,MatrixBType,MatrixCType>::plan(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, const blas::ArgPack_gemm<ScalarType>& srcPackage)
+  : A(A), B(B), C(C), pack(srcPackage){
+  using T = ScalarType;
+  static_assert(std::is_same<typename MatrixAType::StructureType,rect>::value && std::is_same<typename MatrixBType::StructureType,rect>::value && std::is_same<typename MatrixCType::StructureType,rect>::value,
+                "summa::plan requires matrices of rect structure");
+  static_assert(!is_matrix_view<MatrixAType>::value && !is_matrix_view<MatrixBType>::value && !is_matrix_view<MatrixCType>::value,"summa::plan does not take matrix views");
+  bool isRootRow = ((CommInfo.x == CommInfo.z) ? true : false);
+  bool isRootColumn = ((CommInfo.y == CommInfo.z) ? true : false);
+  this->localDimensionM = (srcPackage.transposeA == blas::Transpose::AblasNoTrans ? A.num_rows_local() : A.num_columns_local());
+  this->localDimensionN = (srcPackage.transposeB == blas::Transpose::AblasNoTrans ? B.num_columns_local() : B.num_rows_local());
+  this->localDimensionK = (srcPackage.transposeA == blas::Transpose::AblasNoTrans ? A.num_columns_local() : A.num_rows_local());
+  this->bufferA = (isRootRow ? A.data() : A.scratch()); this->bufferB = (isRootColumn ? B.data() : B.scratch());
+  // Beta is applied on one layer only (as in invoke), so the product is formed and reduced directly in C
+  this->bufferC = C.data();
+  this->root = CommInfo.z; this->row = CommInfo.row; this->column = CommInfo.column; this->depth = CommInfo.depth;
+  this->pack.beta = (CommInfo.z == 0 ? srcPackage.beta : T(0));
+#if MPI_VERSION >= 4
+  MPI_Bcast_init(this->bufferA, A.num_elems(), mpi_type<T>::type, this->root, this->row, MPI_INFO_NULL, &this->requests[0]);
+  MPI_Bcast_init(this->bufferB, B.num_elems(), mpi_type<T>::type, this->root, this->column, MPI_INFO_NULL, &this->requests[1]);
+  MPI_Allreduce_init(MPI_IN_PLACE, this->bufferC, C.num_elems(), mpi_type<T>::type, MPI_SUM, this->depth, MPI_INFO_NULL, &this->requests[2]);
+#else
+  for (auto& request : this->requests){ request = MPI_REQUEST_NULL; }
+#endif
+}
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+summa::plan<MatrixAType,MatrixBType,MatrixCType>::plan(plan&& p)
+  : A(p.A), B(p.B), C(p.C), pack(p.pack), bufferA(p.bufferA), bufferB(p.bufferB), bufferC(p.bufferC),
+    localDimensionM(p.localDimensionM), localDimensionN(p.localDimensionN), localDimensionK(p.localDimensionK), root(p.root), row(p.row), column(p.column), depth(p.depth){
+  for (int i=0; i<3; i++){ this->requests[i] = p.requests[i]; p.requests[i] = MPI_REQUEST_NULL; }
+}
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+summa::plan<MatrixAType,MatrixBType,MatrixCType>::~plan(){
+  for (auto& request : this->requests){ if (request != MPI_REQUEST_NULL){ MPI_Request_free(&request); } }
+}
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+void summa::plan<MatrixAType,MatrixBType,MatrixCType>::execute(){
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_START(Summa::plan);
+#endif
+  using T = ScalarType;
+#if MPI_VERSION >= 4
+  MPI_Startall(2, &this->requests[0]);
+#else
+  MPI_Ibcast(this->bufferA, this->A.num_elems(), mpi_type<T>::type, this->root, this->row, &this->requests[0]);
+  MPI_Ibcast(this->bufferB, this->B.num_elems(), mpi_type<T>::type, this->root, this->column, &this->requests[1]);
+#endif
+  MPI_Waitall(2, &this->requests[0], MPI_STATUSES_IGNORE);
+  blas::engine::_gemm(this->bufferA, this->bufferB, this->bufferC, this->localDimensionM, this->localDimensionN, this->localDimensionK,
+                      this->A.num_rows_local(), this->B.num_rows_local(), this->C.num_rows_local(), this->pack);
+#if MPI_VERSION >= 4
+  MPI_Start(&this->requests[2]);
+#else
+  MPI_Iallreduce(MPI_IN_PLACE, this->bufferC, this->C.num_elems(), mpi_type<T>::type, MPI_SUM, this->depth, &this->requests[2]);
+#endif
+  MPI_Wait(&this->requests[2], MPI_STATUS_IGNORE);
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_STOP(Summa::plan);
+#endif
+}
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType, typename CommType>
+summa::plan<MatrixAType,MatrixBType,MatrixCType> summa::make_plan(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, const blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage){
+  return plan<MatrixAType,MatrixBType,MatrixCType>(A,B,C,std::forward<CommType>(CommInfo),srcPackage);
+}
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+template<typename CommType>
+summa::handle<MatrixAType,MatrixBType,MatrixCType>::handle(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, const blas::ArgPack_gemm<ScalarType>& srcPackage)
+  : A(A), B(B), C(C), pack(srcPackage){
+  using T = ScalarType;
+  static_assert(std::is_same<typename MatrixAType::StructureType,rect>::value && std::is_same<typename MatrixBType::StructureType,rect>::value && std::is_same<typename MatrixCType::StructureType,rect>::value,
+                "summa::iinvoke requires matrices of rect structure");
+  static_assert(!is_matrix_view<MatrixAType>::value && !is_matrix_view<MatrixBType>::value && !is_matrix_view<MatrixCType>::value,"summa::iinvoke does not take matrix views");
+  bool isRootRow = ((CommInfo.x == CommInfo.z) ? true : false);
+  bool isRootColumn = ((CommInfo.y == CommInfo.z) ? true : false);
+  this->localDimensionM = (srcPackage.transposeA == blas::Transpose::AblasNoTrans ? A.num_rows_local() : A.num_columns_local());
+  this->localDimensionN = (srcPackage.transposeB == blas::Transpose::AblasNoTrans ? B.num_columns_local() : B.num_rows_local());
+  this->localDimensionK = (srcPackage.transposeA == blas::Transpose::AblasNoTrans ? A.num_columns_local() : A.num_rows_local());
+  this->bufferA = (isRootRow ? A.data() : A.scratch()); this->bufferB = (isRootColumn ? B.data() : B.scratch());
+  this->depth = CommInfo.depth;
+  this->pack.beta = (CommInfo.z == 0 ? srcPackage.beta : T(0));
+  MPI_Ibcast(this->bufferA, A.num_elems(), mpi_type<T>::type, CommInfo.z, CommInfo.row, &this->requests[0]);
+  MPI_Ibcast(this->bufferB, B.num_elems(), mpi_type<T>::type, CommInfo.z, CommInfo.column, &this->requests[1]);
+  this->requests[2] = MPI_REQUEST_NULL;
+  this->stage = 0;
+}
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+summa::handle<MatrixAType,MatrixBType,MatrixCType>::handle(handle&& h)
+  : A(h.A), B(h.B), C(h.C), pack(h.pack), bufferA(h.bufferA), bufferB(h.bufferB),
+    localDimensionM(h.localDimensionM), localDimensionN(h.localDimensionN), localDimensionK(h.localDimensionK), depth(h.depth), stage(h.stage){
+  for (int i=0; i<3; i++){ this->requests[i] = h.requests[i]; h.requests[i] = MPI_REQUEST_NULL; }
+  h.stage = 2;
+}
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+summa::handle<MatrixAType,MatrixBType,MatrixCType>::~handle(){
+  if (this->stage != 2){ wait(); }
+}
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+bool summa::handle<MatrixAType,MatrixBType,MatrixCType>::test(){
+  int flag;
+  if (this->stage == 0){ MPI_Testall(2, &this->requests[0], &flag, MPI_STATUSES_IGNORE); if (!flag){ return false; } multiply(); }
+  if (this->stage == 1){ MPI_Test(&this->requests[2], &flag, MPI_STATUS_IGNORE); if (!flag){ return false; } this->stage = 2; }
+  return true;
+}
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+void summa::handle<MatrixAType,MatrixBType,MatrixCType>::wait(){
+  if (this->stage == 0){ MPI_Waitall(2, &this->requests[0], MPI_STATUSES_IGNORE); multiply(); }
+  if (this->stage == 1){ MPI_Wait(&this->requests[2], MPI_STATUS_IGNORE); this->stage = 2; }
+}
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType>
+void summa::handle<MatrixAType,MatrixBType,MatrixCType>::multiply(){
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_START(Summa::iinvoke);
+#endif
+  using T = ScalarType;
+  // Beta is applied on one layer only (as in invoke), so the product is formed and reduced directly in C
+  blas::engine::_gemm(this->bufferA, this->bufferB, this->C.data(), this->localDimensionM, this->localDimensionN, this->localDimensionK,
+                      this->A.num_rows_local(), this->B.num_rows_local(), this->C.num_rows_local(), this->pack);
+  MPI_Iallreduce(MPI_IN_PLACE, this->C.data(), this->C.num_elems(), mpi_type<T>::type, MPI_SUM, this->depth, &this->requests[2]);
+  this->stage = 1;
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_STOP(Summa::iinvoke);
+#endif
+}
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType, typename CommType>
+summa::handle<MatrixAType,MatrixBType,MatrixCType> summa::iinvoke(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, const blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage){
+  return handle<MatrixAType,MatrixBType,MatrixCType>(A,B,C,std::forward<CommType>(CommInfo),srcPackage);
+}
+
+template<typename MatrixType, typename CommType>
+void summa::allgather(MatrixType& matrix, CommType&& CommInfo){
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_START(Summa::allgather);
+#endif
+  using T = typename MatrixType::ScalarType;
+  int depth_size; MPI_Comm_size(CommInfo.depth,&depth_size);
+  std::vector<int> counts(depth_size); std::vector<int> displs(depth_size,0);
+  for (int i=0; i<depth_size; i++){ counts[i] = matrix.num_elems()/depth_size + (i < matrix.num_elems()%depth_size ? 1 : 0); if (i>0) displs[i] = displs[i-1]+counts[i-1]; }
+  MPI_Allgatherv(MPI_IN_PLACE, 0, mpi_type<T>::type, matrix.data(), &counts[0], &displs[0], mpi_type<T>::type, CommInfo.depth);
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_STOP(Summa::allgather);
+#endif
+}
+
+template<typename MatrixType, typename CommType>
+std::pair<int64_t,int64_t> summa::segment(const MatrixType& matrix, CommType&& CommInfo){
+  int depth_rank,depth_size; MPI_Comm_rank(CommInfo.depth,&depth_rank); MPI_Comm_size(CommInfo.depth,&depth_size);
+  int64_t num_elems = matrix.num_elems(); int64_t extra = num_elems%depth_size;
+  return std::make_pair(depth_rank*(num_elems/depth_size) + std::min(int64_t(depth_rank),extra), num_elems/depth_size + (depth_rank < extra ? 1 : 0));
+}
+
+template<typename MatrixAType, typename MatrixBType, typename MatrixCType, typename CommType>
+void summa::pipeline(MatrixAType& A, MatrixBType& B, MatrixCType& C, CommType&& CommInfo, blas::ArgPack_gemm<typename MatrixAType::ScalarType>& srcPackage){
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_START(Summa::pipeline);
+#endif
+  using T = typename MatrixAType::ScalarType;
+  bool transA = srcPackage.transposeA != blas::Transpose::AblasNoTrans; bool transB = srcPackage.transposeB != blas::Transpose::AblasNoTrans;
+  auto localDimensionM = (transA ? A.num_columns_local() : A.num_rows_local());
+  auto localDimensionN = (transB ? B.num_rows_local() : B.num_columns_local());
+  auto localDimensionK = (transA ? A.num_rows_local() : A.num_columns_local());
+  int64_t num_panels = std::max(int64_t(1),std::min(int64_t(CommInfo.num_chunks),int64_t(localDimensionK)));
+  int64_t depth = std::min(int64_t(CommInfo.pipeline_depth),num_panels-1);
+  auto panel_start = [&](int64_t idx){ return idx*(localDimensionK/num_panels) + std::min(idx,int64_t(localDimensionK%num_panels)); };
+
+  // Every panel has its own place in the full-size scratch buffers, so a panel in flight never overwrites one being multiplied
+  std::vector<MPI_Request> row_req(num_panels); std::vector<MPI_Request> column_req(num_panels);
+  auto post = [&](int64_t idx){
+    auto start = panel_start(idx); auto len = panel_start(idx+1)-start;
+    // K runs along the columns of A and the rows of B, unless transposed
+    ibcast_panel(A, !transA, start, len, CommInfo.z, CommInfo.row, &row_req[idx]);
+    ibcast_panel(B, transB, start, len, CommInfo.z, CommInfo.column, &column_req[idx]);
+  };
+  for (int64_t idx=0; idx<=depth; idx++){ post(idx); }
+  for (int64_t idx=0; idx<num_panels; idx++){
+    MPI_Wait(&row_req[idx],MPI_STATUS_IGNORE); MPI_Wait(&column_req[idx],MPI_STATUS_IGNORE);
+    auto start = panel_start(idx); auto len = panel_start(idx+1)-start;
+    blas::ArgPack_gemm<T> panelPack(srcPackage.order, srcPackage.transposeA, srcPackage.transposeB, srcPackage.alpha, (idx==0 ? srcPackage.beta : T(1.)));
+    blas::engine::_gemm(A.scratch() + (transA ? start : start*A.num_rows_local()), B.scratch() + (transB ? start*B.num_rows_local() : start), C.scratch(),
+                        localDimensionM, localDimensionN, len, A.num_rows_local(), B.num_rows_local(), C.leading_dimension(1), panelPack);
+    if (idx+depth+1 < num_panels){ post(idx+depth+1); }
+  }
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_STOP(Summa::pipeline);
+#endif
+}
+
+template<typename MatrixType>
+void summa::ibcast_panel(MatrixType& matrix, bool columns, int64_t start, int64_t len, int root, MPI_Comm comm, MPI_Request* request){
+  using T = typename MatrixType::ScalarType;
+  auto dimX = matrix.num_columns_local(); auto dimY = matrix.num_rows_local();
+  if (columns){ MPI_Ibcast(matrix.scratch()+start*dimY, len*dimY, mpi_type<T>::type, root, comm, request); return; }
+  // A panel of rows is strided, so it is described in place rather than packed
+  MPI_Datatype panel_type;
+  MPI_Type_vector(dimX, len, dimY, mpi_type<T>::type, &panel_type);
+  MPI_Type_commit(&panel_type);
+  MPI_Ibcast(matrix.scratch()+start, 1, panel_type, root, comm, request);
+  MPI_Type_free(&panel_type);
+}
+
+template<typename MatrixType>
+void summa::bcast(MatrixType& matrix, int root, MPI_Comm comm){
+  using T = typename MatrixType::ScalarType;
+  // A strided scratch (a view's root swapped onto its parent's storage) is described by a vector type whose signature matches the receivers' contiguous buffers
+  if (matrix.leading_dimension(1) == matrix.num_rows_local()){ MPI_Bcast(matrix.scratch(), matrix.num_elems(), mpi_type<T>::type, root, comm); return; }
+  MPI_Datatype strided_type;
+  MPI_Type_vector(matrix.num_columns_local(), matrix.num_rows_local(), matrix.leading_dimension(1), mpi_type<T>::type, &strided_type);
+  MPI_Type_commit(&strided_type);
+  MPI_Bcast(matrix.scratch(), 1, strided_type, root, comm);
+  MPI_Type_free(&strided_type);
+}
+
+template<typename WirePolicy, typename MatrixType>
+void summa::bcast(MatrixType& matrix, int root, MPI_Comm comm, std::false_type){
+  bcast(matrix, root, comm);
+}
+
+template<typename WirePolicy, typename MatrixType>
+void summa::bcast(MatrixType& matrix, int root, MPI_Comm comm, std::true_type){
+  using R = typename real_type<typename MatrixType::ScalarType>::type; using W = typename WirePolicy::wire_type;
+  int64_t components = sizeof(typename MatrixType::ScalarType)/sizeof(R); int64_t count = matrix.num_elems()*components;
+  int rank,size; MPI_Comm_rank(comm, &rank); MPI_Comm_size(comm, &size);
+  if (size == 1){ return; }
+  std::vector<W> wire(count);
+  if (rank == root){
+    // A view's root encodes its strided block column by column
+    if (matrix.leading_dimension(1) == matrix.num_rows_local()){ WirePolicy::encode(reinterpret_cast<R*>(matrix.scratch()), &wire[0], count); }
+    else{
+      int64_t rows = matrix.num_rows_local()*components; int64_t ld = matrix.leading_dimension(1)*components;
+      for (int64_t i=0; i<matrix.num_columns_local(); i++){ WirePolicy::encode(reinterpret_cast<R*>(matrix.scratch())+i*ld, &wire[i*rows], rows); }
+    }
+  }
+  MPI_Bcast(&wire[0], count, WirePolicy::type(), root, comm);
+  if (rank != root){ WirePolicy::decode(&wire[0], reinterpret_cast<R*>(matrix.scratch()), count); }
+  policy::summa::WireStats::native_bytes() += count*sizeof(R); policy::summa::WireStats::wire_bytes() += count*sizeof(W);
+}
+
+template<typename WirePolicy, typename ScalarType>
+void summa::allreduce(ScalarType* buffer, int64_t count, MPI_Comm comm, std::false_type){
+  MPI_Allreduce(MPI_IN_PLACE, buffer, count, mpi_type<ScalarType>::type, MPI_SUM, comm);
+}
+
+template<typename WirePolicy, typename ScalarType>
+void summa::allreduce(ScalarType* buffer, int64_t count, MPI_Comm comm, std::true_type){
+  using R = typename real_type<ScalarType>::type; using W = typename WirePolicy::wire_type;
+  count *= sizeof(ScalarType)/sizeof(R); R* reals = reinterpret_cast<R*>(buffer);
+  int rank,size; MPI_Comm_rank(comm, &rank); MPI_Comm_size(comm, &size);
+  if (size == 1){ return; }
+  // A reduce-scatter and an allgather, both compressed: each process sums the contributions to its segment in the same (rank) order,
+  //   and every process (the owner included) decodes the segment sums from the wire, so that the replicas of the result agree
+  std::vector<int> counts(size), offsets(size); for (int i=0; i<size; i++){ counts[i] = count/size + (i < count%size ? 1 : 0); offsets[i] = (i==0 ? 0 : offsets[i-1]+counts[i-1]); }
+  std::vector<W> wire(count), segments(counts[rank]*size); std::vector<int> recv_counts(size,counts[rank]), recv_offsets(size); std::vector<R> contribution(counts[rank]);
+  for (int i=0; i<size; i++){ recv_offsets[i] = i*counts[rank]; }
+  WirePolicy::encode(reals, &wire[0], count);
+  MPI_Alltoallv(&wire[0], &counts[0], &offsets[0], WirePolicy::type(), &segments[0], &recv_counts[0], &recv_offsets[0], WirePolicy::type(), comm);
+  R* sum = reals+offsets[rank]; std::fill(sum, sum+counts[rank], R(0));
+  for (int i=0; i<size; i++){
+    WirePolicy::decode(&segments[i*counts[rank]], &contribution[0], counts[rank]);
+    for (int j=0; j<counts[rank]; j++){ sum[j] += contribution[j]; }
+  }
+  WirePolicy::encode(sum, &wire[offsets[rank]], counts[rank]);
+  MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, &wire[0], &counts[0], &offsets[0], WirePolicy::type(), comm);
+  WirePolicy::decode(&wire[0], reals, count);
+  // Each process sends all but its own segment in the reduce-scatter, and its own segment to every other process in the allgather
+  int64_t sent = (count-counts[rank]) + static_cast<int64_t>(size-1)*counts[rank];
+  policy::summa::WireStats::native_bytes() += sent*sizeof(R); policy::summa::WireStats::wire_bytes() += sent*sizeof(W);
+}
+
+template<typename MatrixSrcType, typename MatrixDestType>
+void summa::forward(MatrixSrcType& src, MatrixDestType& dest, int root, MPI_Comm comm, bool isRoot){
+  using T = typename MatrixSrcType::ScalarType;
+  if (isRoot){ bcast(src, root, comm); }
+  else{ MPI_Bcast(dest.scratch(), src.num_elems(), mpi_type<T>::type, root, comm); }
+}
+
+template<typename MatrixType>
+void summa::unpack(MatrixType& matrix){
+  using Structure = typename MatrixType::StructureType;
+  if (!std::is_same<Structure,rfp>::value && !is_tiled<Structure>::value) return;
+  auto dimX = matrix.num_columns_local(); auto dimY = matrix.num_rows_local();
+  serialize<Structure,Structure>::invoke(matrix,matrix,0,dimX,0,dimY,0,dimX,0,dimY,1,2); matrix.swap_pad();
+}
+
+template<typename ScalarType, typename DimensionType>
+void summa::stage(matrix_view<ScalarType,DimensionType>& matrix){
+  matrix._stage_();
+}
+
+template<typename MatrixType, typename ScalarType>
+void summa::accumulate(MatrixType& matrix, ScalarType beta){
+  if (beta != ScalarType(0)){
+    for (auto i=0; i<matrix.num_elems(); i++){ matrix.data()[i] = beta*matrix.data()[i] + matrix.scratch()[i]; }
+  }
+  else{ matrix.swap(); }
+}
+
+template<typename ScalarType, typename DimensionType>
+void summa::accumulate(matrix_view<ScalarType,DimensionType>& matrix, ScalarType beta){
+  matrix._writeback_(beta);
+}
 }
@@ -11,8 +11,10 @@
 namespace qr{
 
 template<class SerializePolicy     = policy::cacqr::Serialize,
-         class IntermediatesPolicy = policy::cacqr::SaveIntermediates>
-class cacqr : public SerializePolicy, public IntermediatesPolicy{
+         class IntermediatesPolicy = policy::cacqr::SaveIntermediates,
+         class PrecisionPolicy     = policy::cacqr::FullPrecision,
+         class MultiplyPolicy      = matmult::summa>
+class cacqr : public SerializePolicy, public IntermediatesPolicy, public PrecisionPolicy{
 public:
   // cacqr is parameterized only by its cholesky-inverse factorization algorithm
   template<typename ScalarT, typename DimensionT, typename CholeskyInversionType>
@@ -20,12 +22,16 @@ public:
   public:
     using ScalarType = ScalarT;
     using DimensionType = DimensionT;
-    using alg_type = cacqr<SerializePolicy,IntermediatesPolicy>;
+    using alg_type = cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>;
     using cholesky_inverse_type = CholeskyInversionType;
     info(const info& p) : num_iter(p.num_iter),cholesky_inverse_args(p.cholesky_inverse_args),Q(p.Q),R(p.R) {}
     info(info&& p) : cholesky_inverse_args(std::move(p.cholesky_inverse_args)) {}
     template<typename CholeskyInversionArgType>
     info(size_t num_iter, CholeskyInversionArgType&& ci_args) : num_iter(num_iter),cholesky_inverse_args(std::forward<CholeskyInversionArgType>(ci_args)) {}
+    ~info(){
+      int finalized; MPI_Finalized(&finalized);
+      if (finalized) square.release();	// its communicators can no longer be freed
+    }
     // User input members
     const size_t num_iter;
     // Sub-algorithm members
@@ -34,9 +40,17 @@ public:
     matrix<ScalarType,DimensionType,rect> Q;
     matrix<ScalarType,DimensionType,typename SerializePolicy::structure> R;
     // Optimizing members
-    std::map<std::pair<DimensionType,DimensionType>,matrix<ScalarType,DimensionType,typename SerializePolicy::structure>> policy_table;
-    std::map<std::pair<DimensionType,DimensionType>,matrix<ScalarType,DimensionType,rect>> rect_table1;
-    std::map<std::pair<DimensionType,DimensionType>,matrix<ScalarType,DimensionType,rect>> rect_table2;
+    using policy_matrix = matrix<ScalarType,DimensionType,typename SerializePolicy::structure,OffloadEachGemm,typename IntermediatesPolicy::allocator>;
+    using rect_matrix = matrix<ScalarType,DimensionType,rect,OffloadEachGemm,typename IntermediatesPolicy::allocator>;
+    allocator_lease<typename IntermediatesPolicy::allocator> lease;	// declared ahead of the workspaces, so that it outlives them
+    workspace<std::pair<DimensionType,DimensionType>,policy_matrix> policy_table;
+    workspace<std::pair<DimensionType,DimensionType>,rect_matrix> rect_table1;
+    workspace<std::pair<DimensionType,DimensionType>,rect_matrix> rect_table2;
+    // The buffers execution uses, resolved from the tables above once per factor: the Gram matrix, and solve's panels of Q, R12 and the diagonal blocks of Rinv
+    rect_matrix* gram = nullptr; rect_matrix* Q1 = nullptr; rect_matrix* Q2 = nullptr; rect_matrix* R12 = nullptr; policy_matrix* Rinv11 = nullptr; policy_matrix* Rinv22 = nullptr;
+    std::unique_ptr<topo::square> square;	// the square grid over Q's cube (c>1 only), kept so that factor neither splits it again nor replans cholinv
+    // factor fills the workspaces above before it runs and seals them, so that execution cannot allocate an intermediate it missed
+    void seal(bool sealed){ policy_table.seal(sealed); rect_table1.seal(sealed); rect_table2.seal(sealed); }
   };
 
   template<typename MatrixType, typename ArgType, typename CommType>
@@ -54,6 +68,8 @@ public:
   template<typename MatrixType, typename ArgType, typename CommType>
   static void apply_QT(MatrixType& src, ArgType& args,CommType&& CommInfo);
 
+  using MP = MultiplyPolicy;
+
 protected:
   template<typename ArgType, typename CommType>
   static void invoke_1d(ArgType& args, CommType&& CommInfo);
@@ -67,6 +83,15 @@ protected:
   template<typename ArgType, typename CommType>
   static void sweep_3d(ArgType& args, CommType&& CommInfo);
 
+  // Runs the Gram matrix and cholesky-inverse factorization of a first sweep in PrecisionPolicy's sweep_type via sweep,
+  //   leaving R and its inverse in args as if a full-precision sweep had run (CommInfo.c,CommInfo.d give the grid of Q)
+  template<typename ArgType, typename CommType, typename SweepType>
+  static void sweep_mixed(ArgType& args, CommType&& CommInfo, SweepType&& sweep);
+
+  // Brings a promoted cholesky-inverse factor's inverse back into agreement with the factor to full precision
+  template<typename ArgType, typename CommType>
+  static void refine_inverse(ArgType& args, CommType&& CommInfo);
+
   template<typename ArgType, typename RectCommType, typename SquareCommType>
   static void sweep_tune(ArgType& args, RectCommType&& RectCommInfo, SquareCommType&& SquareCommInfo);
 
@@ -2,24 +2,21 @@
 
 namespace qr{
 
-template<class SerializePolicy, class IntermediatesPolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
 template<typename ArgType, typename CommType>
-void cacqr<SerializePolicy,IntermediatesPolicy>::sweep_1d(ArgType& args, CommType&& CommInfo){
+void cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::sweep_1d(ArgType& args, CommType&& CommInfo){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(CQR::sweep_1d);
 #endif
   using T = typename ArgType::ScalarType; using SP = SerializePolicy; using IP = IntermediatesPolicy;
   auto localDimensionM = args.Q.num_rows_local(); auto localDimensionN = args.R.num_columns_local(); auto globalDimensionN = args.R.num_columns_global();
-  auto& buffer = SP::buffer(args.R,IP::invoke(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN)));
+  auto& buffer = SP::buffer(args.R,IP::invoke(*args.gram));
   blas::ArgPack_syrk<T> syrkPack(blas::Order::AblasColumnMajor, blas::UpLo::AblasUpper, blas::Transpose::AblasTrans, 1., 0.);
   blas::engine::_syrk(args.Q.data(), buffer.data(), localDimensionN, localDimensionM, localDimensionM, localDimensionN, syrkPack);
   // MPI_Allreduce to replicate the gram matrix on each process
-  SP::compute_gram(args.R,IP::invoke(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN)),CommInfo);
+  SP::compute_gram(args.R,IP::invoke(*args.gram),CommInfo);
   lapack::ArgPack_potrf potrfArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper);
-  lapack::ArgPack_trtri trtriArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper, lapack::Diag::AlapackNonUnit);
-  lapack::engine::_potrf(buffer.data(), localDimensionN, localDimensionN, potrfArgs);
-  std::memcpy(buffer.scratch(), buffer.data(), sizeof(T)*localDimensionN*localDimensionN);
-  lapack::engine::_trtri(buffer.scratch(), localDimensionN, localDimensionN, trtriArgs);
+  lapack::engine::_potrf_trtri(buffer.data(), buffer.scratch(), localDimensionN, localDimensionN, localDimensionN, potrfArgs);
   // Finish by performing local matrix multiplication Q = A*R^{-1}
   blas::ArgPack_trmm<T> trmmPack1(blas::Order::AblasColumnMajor, blas::Side::AblasRight, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
   blas::engine::_trmm(buffer.scratch(), args.Q.data(), localDimensionM, localDimensionN, localDimensionN, localDimensionM, trmmPack1);
@@ -28,9 +25,9 @@ void cacqr<SerializePolicy,IntermediatesPolicy>::sweep_1d(ArgType& args, CommTyp
 #endif
 }
 
-template<class SerializePolicy, class IntermediatesPolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
 template<typename ArgType, typename CommType>
-void cacqr<SerializePolicy,IntermediatesPolicy>::simulate_solve(ArgType& args, CommType&& CommInfo){
+void cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::simulate_solve(ArgType& args, CommType&& CommInfo){
   using SP = SerializePolicy; using IP = IntermediatesPolicy;
   auto localDimensionN = args.R.num_rows_local(); auto localDimensionM = args.Q.num_rows_local();
   auto split1 = (localDimensionN>>args.cholesky_inverse_args.split); auto split2 = localDimensionN-split1;
@@ -39,42 +36,44 @@ void cacqr<SerializePolicy,IntermediatesPolicy>::simulate_solve(ArgType& args, C
   IP::init(args.rect_table2,std::make_pair(split2,split1),nullptr,split2,split1,CommInfo.c,CommInfo.c);
   IP::init(args.policy_table,std::make_pair(split1,split1),nullptr,split1,split1,CommInfo.c,CommInfo.c);
   IP::init(args.policy_table,std::make_pair(split2,split2),nullptr,split2,split2,CommInfo.c,CommInfo.c);
+  args.Q1 = &args.rect_table1.at(std::make_pair(split1,localDimensionM)); args.Q2 = &args.rect_table2.at(std::make_pair(split2,localDimensionM));
+  args.R12 = &args.rect_table2.at(std::make_pair(split2,split1));
+  args.Rinv11 = &args.policy_table.at(std::make_pair(split1,split1)); args.Rinv22 = &args.policy_table.at(std::make_pair(split2,split2));
 }
 
-template<class SerializePolicy, class IntermediatesPolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
 template<typename ArgType, typename CommType>
-void cacqr<SerializePolicy,IntermediatesPolicy>::solve(ArgType& args, CommType&& CommInfo){
+void cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::solve(ArgType& args, CommType&& CommInfo){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(CQR::solve);
 #endif
   using T = typename ArgType::ScalarType; using SP = SerializePolicy; using IP = IntermediatesPolicy;
   auto localDimensionN = args.R.num_rows_local(); auto localDimensionM = args.Q.num_rows_local();
   auto split1 = (localDimensionN>>args.cholesky_inverse_args.split); auto split2 = localDimensionN-split1;
-  serialize<rect,rect>::invoke(args.Q,IP::invoke(args.rect_table1,std::make_pair(split1,localDimensionM)),0,split1,0,localDimensionM,0,split1,0,localDimensionM);
-  serialize<rect,rect>::invoke(args.Q,IP::invoke(args.rect_table2,std::make_pair(split2,localDimensionM)),split1,localDimensionN,0,localDimensionM,0,split2,0,localDimensionM);
-  serialize<uppertri,uppertri>::invoke(args.cholesky_inverse_args.Rinv,IP::invoke(args.policy_table,std::make_pair(split1,split1)),0,split1,0,split1,0,split1,0,split1);
-  serialize<rect,rect>::invoke(args.cholesky_inverse_args.R,IP::invoke(args.rect_table2,std::make_pair(split2,split1)),split1,localDimensionN,0,split1,0,split2,0,split1);
-  blas::ArgPack_gemm<T> gemmPack(blas::Order::AblasColumnMajor, blas::Transpose::AblasNoTrans, blas::Transpose::AblasNoTrans, 1., -1.);
+  serialize<rect,rect>::invoke(args.Q,IP::invoke(*args.Q1),0,split1,0,localDimensionM,0,split1,0,localDimensionM);
+  serialize<rect,rect>::invoke(args.Q,IP::invoke(*args.Q2),split1,localDimensionN,0,localDimensionM,0,split2,0,localDimensionM);
+  serialize<uppertri,uppertri>::invoke(args.cholesky_inverse_args.Rinv,IP::invoke(*args.Rinv11),0,split1,0,split1,0,split1,0,split1);
+  serialize<rect,rect>::invoke(args.cholesky_inverse_args.R,IP::invoke(*args.R12),split1,localDimensionN,0,split1,0,split2,0,split1);
+  blas::ArgPack_gemm<T> gemmPack(blas::Order::AblasColumnMajor, blas::Transpose::AblasNoTrans, blas::Transpose::AblasNoTrans, -1., 1.);
   blas::ArgPack_trmm<T> trmmPack(blas::Order::AblasColumnMajor, blas::Side::AblasRight, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
-  matmult::summa::invoke(IP::invoke(args.policy_table,std::make_pair(split1,split1)),IP::invoke(args.rect_table1,std::make_pair(split1,localDimensionM)),
+  MP::invoke(IP::invoke(*args.Rinv11),IP::invoke(*args.Q1),
                          std::forward<CommType>(CommInfo), trmmPack);
-  serialize<uppertri,uppertri>::invoke(args.cholesky_inverse_args.Rinv,IP::invoke(args.policy_table,std::make_pair(split2,split2)),split1,localDimensionN,split1,localDimensionN,0,split2,0,split2);
-  matmult::summa::invoke(IP::invoke(args.rect_table1,std::make_pair(split1,localDimensionM)),IP::invoke(args.rect_table2,std::make_pair(split2,split1)),
-                         IP::invoke(args.rect_table2,std::make_pair(split2,localDimensionM)), std::forward<CommType>(CommInfo), gemmPack);
-  matmult::summa::invoke(IP::invoke(args.policy_table,std::make_pair(split2,split2)),IP::invoke(args.rect_table2,std::make_pair(split2,localDimensionM)),
+  serialize<uppertri,uppertri>::invoke(args.cholesky_inverse_args.Rinv,IP::invoke(*args.Rinv22),split1,localDimensionN,split1,localDimensionN,0,split2,0,split2);
+  MP::invoke(IP::invoke(*args.Q1),IP::invoke(*args.R12),
+                         IP::invoke(*args.Q2), std::forward<CommType>(CommInfo), gemmPack);
+  MP::invoke(IP::invoke(*args.Rinv22),IP::invoke(*args.Q2),
                          std::forward<CommType>(CommInfo), trmmPack);
-  serialize<rect,rect>::invoke(IP::invoke(args.rect_table1,std::make_pair(split1,localDimensionM)),args.Q,0,split1,0,localDimensionM,0,split1,0,localDimensionM);
-  serialize<rect,rect>::invoke(IP::invoke(args.rect_table2,std::make_pair(split2,localDimensionM)),args.Q,0,split2,0,localDimensionM,split1,localDimensionN,0,localDimensionM);
-  IP::flush(args.rect_table1[std::make_pair(split1,localDimensionM)]); IP::flush(args.rect_table2[std::make_pair(split2,localDimensionM)]);
-  IP::flush(args.policy_table[std::make_pair(split1,split1)]); IP::flush(args.policy_table[std::make_pair(split2,split2)]);
+  serialize<rect,rect>::invoke(IP::invoke(*args.Q1),args.Q,0,split1,0,localDimensionM,0,split1,0,localDimensionM);
+  serialize<rect,rect>::invoke(IP::invoke(*args.Q2),args.Q,0,split2,0,localDimensionM,split1,localDimensionN,0,localDimensionM);
+  IP::flush(*args.Q1); IP::flush(*args.Q2); IP::flush(*args.Rinv11); IP::flush(*args.Rinv22);
 #ifdef FUNCTION_SYMBOLS
   CRITTER_STOP(CQR::solve);
 #endif
 }
 
-template<class SerializePolicy, class IntermediatesPolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
 template<typename ArgType, typename CommType>
-void cacqr<SerializePolicy,IntermediatesPolicy>::sweep_3d(ArgType& args, CommType&& CommInfo){
+void cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::sweep_3d(ArgType& args, CommType&& CommInfo){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(CQR::sweep_3d);
 #endif
@@ -85,15 +84,22 @@ void cacqr<SerializePolicy,IntermediatesPolicy>::sweep_3d(ArgType& args, CommTyp
   // Need to perform the multiple steps to obtain partition of A
   auto localDimensionN = args.Q.num_columns_local(); auto localDimensionM = args.Q.num_rows_local();
   auto globalDimensionN = args.Q.num_columns_global(); auto globalDimensionM = args.Q.num_rows_global(); auto sizeA = args.Q.num_elems();
-  auto& buffer = SP::buffer(args.R,IP::invoke(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN)));
+  auto& buffer = SP::buffer(args.R,IP::invoke(*args.gram));
   bool isRootRow = ((CommInfo.x == CommInfo.z) ? true : false);
   bool isRootColumn = ((CommInfo.y == CommInfo.z) ? true : false);
   if (isRootRow) { args.Q.swap(); }
   MPI_Bcast(args.Q.scratch(), sizeA, mpi_type<T>::type, CommInfo.z, CommInfo.row);
   blas::ArgPack_gemm<T> gemmPack1(blas::Order::AblasColumnMajor, blas::Transpose::AblasTrans, blas::Transpose::AblasNoTrans, 1., 0.);
   if (isRootRow) { args.Q.swap(); }
-  blas::engine::_gemm((isRootRow ? args.Q.data() : args.Q.scratch()), args.Q.data(), buffer.data(), localDimensionN, localDimensionN,
-                      localDimensionM, localDimensionM, localDimensionM, localDimensionN, gemmPack1);
+  // cholinv only reads the upper triangle of each local block of the Gram matrix, so only it is formed
+  if (isRootRow){
+    blas::ArgPack_syrk<T> syrkPack1(blas::Order::AblasColumnMajor, blas::UpLo::AblasUpper, blas::Transpose::AblasTrans, 1., 0.);
+    blas::engine::_syrk(args.Q.data(), buffer.data(), localDimensionN, localDimensionM, localDimensionM, localDimensionN, syrkPack1);
+  }
+  else{
+    blas::engine::_gemmt(args.Q.scratch(), args.Q.data(), buffer.data(), localDimensionN, localDimensionM, localDimensionM, localDimensionM, localDimensionN,
+                         blas::UpLo::AblasUpper, gemmPack1);
+  }
   SP::transfer_start(args.R,buffer);
   MPI_Reduce((isRootColumn ? MPI_IN_PLACE : args.R.data()), args.R.data(), args.R.num_elems(), mpi_type<T>::type, MPI_SUM, CommInfo.z, CommInfo.column);
   MPI_Bcast(args.R.data(), args.R.num_elems(), mpi_type<T>::type, CommInfo.y, CommInfo.depth);
@@ -108,7 +114,7 @@ void cacqr<SerializePolicy,IntermediatesPolicy>::sweep_3d(ArgType& args, CommTyp
   if (args.cholesky_inverse_args.complete_inv){
     blas::ArgPack_trmm<T> trmmPack1(blas::Order::AblasColumnMajor, blas::Side::AblasRight, blas::UpLo::AblasUpper,
                                     blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
-    matmult::summa::invoke(args.cholesky_inverse_args.Rinv,args.Q, std::forward<CommType>(CommInfo), trmmPack1);
+    MP::invoke(args.cholesky_inverse_args.Rinv,args.Q, std::forward<CommType>(CommInfo), trmmPack1);
   }
   else{ solve(args,std::forward<CommType>(CommInfo)); }
 #ifdef ALGORITHMIC_SYMBOLS
@@ -119,9 +125,9 @@ void cacqr<SerializePolicy,IntermediatesPolicy>::sweep_3d(ArgType& args, CommTyp
 #endif
 }
 
-template<class SerializePolicy, class IntermediatesPolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
 template<typename ArgType, typename RectCommType, typename SquareCommType>
-void cacqr<SerializePolicy,IntermediatesPolicy>::sweep_tune(ArgType& args, RectCommType&& RectCommInfo, SquareCommType&& SquareCommInfo){
+void cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::sweep_tune(ArgType& args, RectCommType&& RectCommInfo, SquareCommType&& SquareCommInfo){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(CQR::sweep_tune);
 #endif
@@ -134,15 +140,22 @@ void cacqr<SerializePolicy,IntermediatesPolicy>::sweep_tune(ArgType& args, RectC
   // Need to perform the multiple steps to obtain partition of A
   auto localDimensionM = args.Q.num_rows_local(); auto localDimensionN = args.Q.num_columns_local();
   auto globalDimensionN = args.Q.num_columns_global(); auto globalDimensionM = args.Q.num_rows_global(); auto sizeA = args.Q.num_elems();
-  auto& buffer = SP::buffer(args.R,IP::invoke(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN)));
+  auto& buffer = SP::buffer(args.R,IP::invoke(*args.gram));
   bool isRootRow = ((RectCommInfo.x == RectCommInfo.z) ? true : false);
   bool isRootColumn = ((columnContigRank == RectCommInfo.z) ? true : false);
   if (isRootRow) { args.Q.swap(); }
   MPI_Bcast(args.Q.scratch(), sizeA, mpi_type<T>::type, RectCommInfo.z, RectCommInfo.row);
   blas::ArgPack_gemm<T> gemmPack1(blas::Order::AblasColumnMajor, blas::Transpose::AblasTrans, blas::Transpose::AblasNoTrans, 1., 0.);
   if (isRootRow) { args.Q.swap(); }
-  blas::engine::_gemm((isRootRow ? args.Q.data() : args.Q.scratch()), args.Q.data(), buffer.data(), localDimensionN, localDimensionN,
-                      localDimensionM, localDimensionM, localDimensionM, localDimensionN, gemmPack1);
+  // cholinv only reads the upper triangle of each local block of the Gram matrix, so only it is formed
+  if (isRootRow){
+    blas::ArgPack_syrk<T> syrkPack1(blas::Order::AblasColumnMajor, blas::UpLo::AblasUpper, blas::Transpose::AblasTrans, 1., 0.);
+    blas::engine::_syrk(args.Q.data(), buffer.data(), localDimensionN, localDimensionM, localDimensionM, localDimensionN, syrkPack1);
+  }
+  else{
+    blas::engine::_gemmt(args.Q.scratch(), args.Q.data(), buffer.data(), localDimensionN, localDimensionM, localDimensionM, localDimensionM, localDimensionN,
+                         blas::UpLo::AblasUpper, gemmPack1);
+  }
   SP::transfer_start(args.R,buffer);
   MPI_Reduce((isRootColumn ? MPI_IN_PLACE : args.R.data()), args.R.data(), args.R.num_elems(), mpi_type<T>::type, MPI_SUM, RectCommInfo.z, RectCommInfo.column_contig);
   MPI_Allreduce(MPI_IN_PLACE, args.R.data(), args.R.num_elems(), mpi_type<T>::type,MPI_SUM, RectCommInfo.column_alt);
@@ -158,7 +171,7 @@ void cacqr<SerializePolicy,IntermediatesPolicy>::sweep_tune(ArgType& args, RectC
   if (args.cholesky_inverse_args.complete_inv){
     blas::ArgPack_trmm<T> trmmPack1(blas::Order::AblasColumnMajor, blas::Side::AblasRight, blas::UpLo::AblasUpper,
                                     blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
-    matmult::summa::invoke(args.cholesky_inverse_args.Rinv,args.Q, std::forward<SquareCommType>(SquareCommInfo), trmmPack1);
+    MP::invoke(args.cholesky_inverse_args.Rinv,args.Q, std::forward<SquareCommType>(SquareCommInfo), trmmPack1);
   }
   else{ solve(args,std::forward<SquareCommType>(SquareCommInfo)); }
 #ifdef ALGORITHMIC_SYMBOLS
@@ -169,44 +182,131 @@ void cacqr<SerializePolicy,IntermediatesPolicy>::sweep_tune(ArgType& args, RectC
 #endif
 }
 
-template<class SerializePolicy, class IntermediatesPolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
+template<typename ArgType, typename CommType, typename SweepType>
+void cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::sweep_mixed(ArgType& args, CommType&& CommInfo, SweepType&& sweep){
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_START(CQR::sweep_mixed);
+#endif
+  using T = typename ArgType::ScalarType; using U = typename ArgType::DimensionType; using SP = SerializePolicy; using IP = IntermediatesPolicy;
+  using F = typename PrecisionPolicy::template sweep_type<T>; using CI = typename std::remove_reference<ArgType>::type::cholesky_inverse_type;
+  auto globalDimensionN = args.Q.num_columns_global(); auto globalDimensionM = args.Q.num_rows_global();
+  auto& ci_args = args.cholesky_inverse_args;
+  typename std::remove_reference<ArgType>::type::alg_type::template info<F,U,CI> sweep_args(1,typename CI::template info<F,U>(true,ci_args.split,ci_args.bc_mult_dim,ci_args.dir));
+  sweep_args.Q._register_(globalDimensionN,globalDimensionM,CommInfo.c,CommInfo.d);
+  sweep_args.R._register_(globalDimensionN,globalDimensionN,CommInfo.c,CommInfo.c);
+  for (U i=0; i<args.Q.num_elems(); i++){ sweep_args.Q.data()[i] = static_cast<F>(args.Q.data()[i]); }
+  IP::init(sweep_args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN),globalDimensionN,globalDimensionN,CommInfo.c,CommInfo.c);
+  sweep_args.gram = &sweep_args.rect_table1.at(std::make_pair(globalDimensionN,globalDimensionN));
+  sweep_args.seal(true);
+  sweep(sweep_args);
+  // Promote R and its inverse to wherever the next sweep expects the previous one to have left them.
+  //   The caller forms Q = A*R^{-1} in full precision, as a Q rounded to sweep_type would limit the residual of the final factorization to sweep_type's precision.
+  //   The inverse is always completed, so that it can be brought back into agreement with R (see refine_inverse) before forming Q.
+  if (CommInfo.c == 1){
+    auto& sweep_buffer = SP::buffer(sweep_args.R,IP::invoke(*sweep_args.gram));
+    auto& buffer = SP::buffer(args.R,IP::invoke(*args.gram));
+    for (U i=0; i<buffer.num_elems(); i++){ buffer.data()[i] = static_cast<T>(sweep_buffer.data()[i]); }
+    // The inverse is recomputed from the promoted factor (rather than promoted itself) so that the two agree to full precision
+    std::memcpy(buffer.scratch(), buffer.data(), sizeof(T)*buffer.num_elems());
+    lapack::ArgPack_trtri trtriArgs(lapack::Order::AlapackColumnMajor, lapack::UpLo::AlapackUpper, lapack::Diag::AlapackNonUnit);
+    lapack::engine::_trtri(buffer.scratch(), globalDimensionN, globalDimensionN, trtriArgs);
+  }
+  else{
+    ci_args.R._register_(globalDimensionN,globalDimensionN,CommInfo.c,CommInfo.c); ci_args.Rinv._register_(globalDimensionN,globalDimensionN,CommInfo.c,CommInfo.c);
+    for (U i=0; i<ci_args.R.num_elems(); i++){ ci_args.R.data()[i] = static_cast<T>(sweep_args.cholesky_inverse_args.R.data()[i]); }
+    for (U i=0; i<ci_args.Rinv.num_elems(); i++){ ci_args.Rinv.data()[i] = static_cast<T>(sweep_args.cholesky_inverse_args.Rinv.data()[i]); }
+  }
+  IP::flush(*sweep_args.gram);
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_STOP(CQR::sweep_mixed);
+#endif
+}
+
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
+template<typename ArgType, typename CommType>
+void cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::refine_inverse(ArgType& args, CommType&& CommInfo){
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_START(CQR::refine_inverse);
+#endif
+  using T = typename ArgType::ScalarType; using U = typename ArgType::DimensionType;
+  auto& ci_args = args.cholesky_inverse_args;
+  using Structure = typename std::remove_reference<decltype(ci_args.Rinv)>::type::StructureType;
+  auto globalDimensionN = ci_args.R.num_columns_global(); auto localDimensionN = ci_args.R.num_columns_local();
+  // Rect factors may hold garbage in their strictly lower triangle, which trmm would read on processes off the diagonal of the slice
+  if (std::is_same<Structure,rect>::value){
+    util::remove_triangle(ci_args.R, CommInfo.x, CommInfo.y, CommInfo.d, 'U'); util::remove_triangle(ci_args.Rinv, CommInfo.x, CommInfo.y, CommInfo.d, 'U');
+  }
+  // One Newton-Schulz step, Rinv <- Rinv + Rinv*(I - R*Rinv), squares the relative error of the promoted inverse
+  matrix<T,U,rect> W(globalDimensionN,globalDimensionN,CommInfo.d,CommInfo.d);
+  serialize<Structure,rect>::invoke(ci_args.Rinv,W,0,localDimensionN,0,localDimensionN,0,localDimensionN,0,localDimensionN);
+  blas::ArgPack_trmm<T> trmmPack(blas::Order::AblasColumnMajor, blas::Side::AblasLeft, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
+  MP::invoke(ci_args.R, W, std::forward<CommType>(CommInfo), trmmPack);
+  for (U i=0; i<localDimensionN; i++){
+    for (U j=0; j<localDimensionN; j++){ W.data()[i*localDimensionN+j] = (i*CommInfo.d+CommInfo.x == j*CommInfo.d+CommInfo.y ? T(1.) : T(0.)) - W.data()[i*localDimensionN+j]; }
+  }
+  util::remove_triangle(W, CommInfo.x, CommInfo.y, CommInfo.d, 'U');
+  MP::invoke(ci_args.Rinv, W, std::forward<CommType>(CommInfo), trmmPack);
+  for (U i=0; i<localDimensionN; i++){
+    for (U j=0; j<(std::is_same<Structure,rect>::value ? localDimensionN : i+1); j++){ ci_args.Rinv.data()[ci_args.Rinv.offset_local(i,j)] += W.data()[i*localDimensionN+j]; }
+  }
+#ifdef FUNCTION_SYMBOLS
+  CRITTER_STOP(CQR::refine_inverse);
+#endif
+}
+
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
 template<typename ArgType, typename CommType>
-void cacqr<SerializePolicy,IntermediatesPolicy>::invoke_1d(ArgType& args, CommType&& CommInfo){
+void cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::invoke_1d(ArgType& args, CommType&& CommInfo){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(CQR::invoke_1d);
 #endif
   using T = typename ArgType::ScalarType; using SP = SerializePolicy; using IP = IntermediatesPolicy;
+  using PP = PrecisionPolicy;
   auto globalDimensionN = args.R.num_columns_global(); auto localDimensionN = args.R.num_columns_local();
-  sweep_1d(args, std::forward<CommType>(CommInfo));
+  if (std::is_same<typename PP::template sweep_type<T>,T>::value || args.num_iter==1){ sweep_1d(args, std::forward<CommType>(CommInfo)); }
+  else{
+    sweep_mixed(args, std::forward<CommType>(CommInfo), [&](auto& sweep_args){ sweep_1d(sweep_args, std::forward<CommType>(CommInfo)); });
+    blas::ArgPack_trmm<T> trmmPack1(blas::Order::AblasColumnMajor, blas::Side::AblasRight, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
+    blas::engine::_trmm(SP::buffer(args.R,IP::invoke(*args.gram)).scratch(), args.Q.data(),
+                        args.Q.num_rows_local(), localDimensionN, localDimensionN, args.Q.num_rows_local(), trmmPack1);
+  }
   if (args.num_iter>1){
-    SP::save_R_1d(args.R,IP::invoke(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN)));
+    SP::save_R_1d(args.R,IP::invoke(*args.gram));
     sweep_1d(args, std::forward<CommType>(CommInfo));
     blas::ArgPack_trmm<T> trmmPack1(blas::Order::AblasColumnMajor, blas::Side::AblasRight, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
-    blas::engine::_trmm(SP::retrieve_intermediate_R_1d(args.R,IP::invoke(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN))),
-                        SP::retrieve_final_R_1d(args.R,IP::invoke(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN))),
+    blas::engine::_trmm(SP::retrieve_intermediate_R_1d(args.R,IP::invoke(*args.gram)),
+                        SP::retrieve_final_R_1d(args.R,IP::invoke(*args.gram)),
                         localDimensionN, localDimensionN, localDimensionN, localDimensionN, trmmPack1);
-    SP::complete_1d(args.R,IP::invoke(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN)));
+    SP::complete_1d(args.R,IP::invoke(*args.gram));
   }
 #ifdef FUNCTION_SYMBOLS
   CRITTER_STOP(CQR::invoke_1d);
 #endif
 }
 
-template<class SerializePolicy, class IntermediatesPolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
 template<typename ArgType, typename CommType>
-void cacqr<SerializePolicy,IntermediatesPolicy>::invoke_3d(ArgType& args, CommType&& CommInfo){
+void cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::invoke_3d(ArgType& args, CommType&& CommInfo){
 #ifdef FUNCTION_SYMBOLS
   CRITTER_START(CQR::invoke_3d);
 #endif
   using T = typename ArgType::ScalarType; using SP = SerializePolicy; using IP = IntermediatesPolicy;
+  using PP = PrecisionPolicy;
   auto globalDimensionN = args.Q.num_columns_global(); auto localDimensionN = args.Q.num_columns_local();
-  sweep_3d(args, std::forward<CommType>(CommInfo));
+  if (std::is_same<typename PP::template sweep_type<T>,T>::value || args.num_iter==1){ sweep_3d(args, std::forward<CommType>(CommInfo)); }
+  else{
+    sweep_mixed(args, std::forward<CommType>(CommInfo), [&](auto& sweep_args){ sweep_3d(sweep_args, std::forward<CommType>(CommInfo)); });
+    refine_inverse(args, std::forward<CommType>(CommInfo));
+    blas::ArgPack_trmm<T> trmmPack1(blas::Order::AblasColumnMajor, blas::Side::AblasRight, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
+    MP::invoke(args.cholesky_inverse_args.Rinv,args.Q, std::forward<CommType>(CommInfo), trmmPack1);
+  }
   if (args.num_iter>1){
-    SP::save_R_3d(args.cholesky_inverse_args.R,args.R,IP::invoke(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN)));
+    SP::save_R_3d(args.cholesky_inverse_args.R,args.R,IP::invoke(*args.gram));
     sweep_3d(args, std::forward<CommType>(CommInfo));
     blas::ArgPack_trmm<T> trmmPack1(blas::Order::AblasColumnMajor, blas::Side::AblasRight, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
     if (std::is_same<typename std::remove_reference<ArgType>::type::cholesky_inverse_type::SP,cholesky::policy::cholinv::NoSerialize>::value) { util::remove_triangle_local(args.cholesky_inverse_args.R, CommInfo.x, CommInfo.y, CommInfo.c, 'U'); }
-    matmult::summa::invoke(SP::retrieve_intermediate_R_3d(args.R,IP::invoke(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN))), args.cholesky_inverse_args.R, std::forward<CommType>(CommInfo), trmmPack1);
+    MP::invoke(SP::retrieve_intermediate_R_3d(args.R,IP::invoke(*args.gram)), args.cholesky_inverse_args.R, std::forward<CommType>(CommInfo), trmmPack1);
   }
   serialize<uppertri,uppertri>::invoke(args.cholesky_inverse_args.R,args.R,0,localDimensionN,0,localDimensionN,0,localDimensionN,0,localDimensionN);
 #ifdef FUNCTION_SYMBOLS
@@ -214,42 +314,57 @@ void cacqr<SerializePolicy,IntermediatesPolicy>::invoke_3d(ArgType& args, CommTy
 #endif
 }
 
-template<class SerializePolicy, class IntermediatesPolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
 template<typename MatrixType, typename ArgType, typename CommType>
-void cacqr<SerializePolicy,IntermediatesPolicy>::factor(const MatrixType& A, ArgType& args, CommType&& CommInfo){
+void cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::factor(const MatrixType& A, ArgType& args, CommType&& CommInfo){
   CRITTER_START(CQR::factor);
-  using T = typename MatrixType::ScalarType; using SP = SerializePolicy; using IP = IntermediatesPolicy;
+  using T = typename MatrixType::ScalarType; using SP = SerializePolicy; using IP = IntermediatesPolicy; using PP = PrecisionPolicy;
   static_assert(std::is_same<typename MatrixType::StructureType,rect>::value,"qr::cacqr requires matrices of rect structure");
   auto globalDimensionN = A.num_columns_global(); auto globalDimensionM = A.num_rows_global(); auto localDimensionN = A.num_columns_local(); auto localDimensionM = A.num_rows_local();
   args.Q._register_(globalDimensionN,globalDimensionM,CommInfo.c,CommInfo.d);
   args.R._register_(globalDimensionN,globalDimensionN,CommInfo.c,CommInfo.c);
   serialize<rect,rect>::invoke(A,args.Q,0,localDimensionN,0,localDimensionM,0,localDimensionN,0,localDimensionM);
 
+  args.seal(false);
   IP::init(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN),globalDimensionN,globalDimensionN,CommInfo.c,CommInfo.c);
+  args.gram = &args.rect_table1.at(std::make_pair(globalDimensionN,globalDimensionN));
+  if ((CommInfo.c != 1) && !args.cholesky_inverse_args.complete_inv) simulate_solve(args,std::forward<CommType>(CommInfo));
+  args.seal(true);
   if (CommInfo.c == 1){ invoke_1d(args, std::forward<CommType>(CommInfo)); }
   else{
-    if (!args.cholesky_inverse_args.complete_inv) simulate_solve(args,std::forward<CommType>(CommInfo));
-    if (CommInfo.c == CommInfo.d){ invoke_3d(args, topo::square(CommInfo.cube,CommInfo.c,CommInfo.layout,CommInfo.num_chunks)); }
+    // The square grid is rebuilt only for a cube with other processes (or another process order) than the one it was built over
+    int congruence = MPI_UNEQUAL; if (args.square){ MPI_Comm_compare(args.square->world, CommInfo.cube, &congruence); }
+    if (((congruence != MPI_IDENT) && (congruence != MPI_CONGRUENT)) || (args.square->c != CommInfo.c) || (args.square->layout != CommInfo.layout) ||
+        (args.square->num_chunks != CommInfo.num_chunks) || (args.square->pipeline_depth != CommInfo.pipeline_depth)){
+      args.square.reset(new topo::square(CommInfo.cube,CommInfo.c,CommInfo.layout,CommInfo.num_chunks,CommInfo.pipeline_depth));
+    }
+    if (CommInfo.c == CommInfo.d){ invoke_3d(args, *args.square); }
     else{
-      auto SquareTopo = topo::square(CommInfo.cube,CommInfo.c,CommInfo.layout,CommInfo.num_chunks);
-      sweep_tune(args, std::forward<CommType>(CommInfo), SquareTopo);
+      auto& SquareTopo = *args.square;
+      if (std::is_same<typename PP::template sweep_type<T>,T>::value || args.num_iter==1){ sweep_tune(args, std::forward<CommType>(CommInfo), SquareTopo); }
+      else{
+        sweep_mixed(args, std::forward<CommType>(CommInfo), [&](auto& sweep_args){ sweep_tune(sweep_args, std::forward<CommType>(CommInfo), SquareTopo); });
+        refine_inverse(args, SquareTopo);
+        blas::ArgPack_trmm<T> trmmPack1(blas::Order::AblasColumnMajor, blas::Side::AblasRight, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
+        MP::invoke(args.cholesky_inverse_args.Rinv,args.Q, SquareTopo, trmmPack1);
+      }
       if (args.num_iter>1){
-        SP::save_R_3d(args.cholesky_inverse_args.R,args.R,IP::invoke(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN)));
+        SP::save_R_3d(args.cholesky_inverse_args.R,args.R,IP::invoke(*args.gram));
         sweep_tune(args, std::forward<CommType>(CommInfo), SquareTopo);
         blas::ArgPack_trmm<T> trmmPack1(blas::Order::AblasColumnMajor, blas::Side::AblasRight, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
         if (std::is_same<typename std::remove_reference<ArgType>::type::cholesky_inverse_type::SP,cholesky::policy::cholinv::NoSerialize>::value) { util::remove_triangle_local(args.cholesky_inverse_args.R, SquareTopo.x, SquareTopo.y, SquareTopo.c, 'U'); }
-        matmult::summa::invoke(SP::retrieve_intermediate_R_3d(args.R,IP::invoke(args.rect_table1,std::make_pair(globalDimensionN,globalDimensionN))), args.cholesky_inverse_args.R, SquareTopo, trmmPack1);
+        MP::invoke(SP::retrieve_intermediate_R_3d(args.R,IP::invoke(*args.gram)), args.cholesky_inverse_args.R, SquareTopo, trmmPack1);
       }
       serialize<uppertri,uppertri>::invoke(args.cholesky_inverse_args.R,args.R,0,localDimensionN,0,localDimensionN,0,localDimensionN,0,localDimensionN);
     }
   }
-  IP::flush(args.rect_table1[std::make_pair(globalDimensionN,globalDimensionN)]);
+  IP::flush(*args.gram);
   CRITTER_STOP(CQR::factor);
 }
 
-template<class SerializePolicy, class IntermediatesPolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
 template<typename ArgType, typename CommType>
-matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> cacqr<SerializePolicy,IntermediatesPolicy>::construct_Q(ArgType& args, CommType&& CommInfo){
+matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::construct_Q(ArgType& args, CommType&& CommInfo){
   CRITTER_START(qr::cacqr::construct_Q);
   auto localDimensionM = args.Q.num_rows_local(); auto localDimensionN = args.Q.num_columns_local();
   matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> ret(args.Q.num_columns_global(),args.Q.num_rows_global(),CommInfo.c, CommInfo.d);
@@ -258,9 +373,9 @@ matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> cacqr<
   return ret;
 }
 
-template<class SerializePolicy, class IntermediatesPolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
 template<typename ArgType, typename CommType>
-matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> cacqr<SerializePolicy,IntermediatesPolicy>::construct_R(ArgType& args, CommType&& CommInfo){
+matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::construct_R(ArgType& args, CommType&& CommInfo){
   CRITTER_START(qr::cacqr::construct_R);
   auto localDimensionM = args.R.num_rows_local(); auto localDimensionN = args.R.num_columns_local();
   matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> ret(args.R.num_columns_global(),args.R.num_rows_global(),CommInfo.c, CommInfo.c);
@@ -269,18 +384,18 @@ matrix<typename ArgType::ScalarType,typename ArgType::DimensionType,rect> cacqr<
   return ret;
 }
 
-template<class SerializePolicy, class IntermediatesPolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
 template<typename MatrixType, typename ArgType, typename CommType>
-void cacqr<SerializePolicy,IntermediatesPolicy>::apply_Q(MatrixType& src, ArgType& args,CommType&& CommInfo){
+void cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::apply_Q(MatrixType& src, ArgType& args,CommType&& CommInfo){
   CRITTER_START(qr::cacqr::apply_Q);
   using T = typename MatrixType::ScalarType;
   blas::ArgPack_gemm<T> gemmPack(blas::Order::AblasColumnMajor, blas::Transpose::AblasNoTrans, blas::Transpose::AblasNoTrans, 1., 0.);
-  auto out = args.Q; matmult::summa::invoke(args.Q,src,out,gemmPack,std::forward<CommType>(CommInfo));
+  auto out = args.Q; MP::invoke(args.Q,src,out,gemmPack,std::forward<CommType>(CommInfo));
   CRITTER_STOP(qr::cacqr::apply_Q);
 }
 
-template<class SerializePolicy, class IntermediatesPolicy>
+template<class SerializePolicy, class IntermediatesPolicy, class PrecisionPolicy, class MultiplyPolicy>
 template<typename MatrixType, typename ArgType, typename CommType>
-void cacqr<SerializePolicy,IntermediatesPolicy>::apply_QT(MatrixType& src, ArgType& args,CommType&& CommInfo) { assert(0) && "not implemented"; }
+void cacqr<SerializePolicy,IntermediatesPolicy,PrecisionPolicy,MultiplyPolicy>::apply_QT(MatrixType& src, ArgType& args,CommType&& CommInfo) { assert(0) && "not implemented"; }
 
 }
@@ -139,16 +139,21 @@ protected:
 // ***********************************************************************************************************************************************************************
 class SaveIntermediates{
 protected:
+  using allocator = HeapAllocator;
+
   template<typename TableType, typename KeyType, typename... ValueTypes>
   static void init(TableType& table, KeyType&& key, ValueTypes&&... values){
-    if (table.find(key) == table.end()){
-      table.emplace(std::piecewise_construct,std::forward_as_tuple(std::forward<KeyType>(key)),std::forward_as_tuple(std::forward<ValueTypes>(values)...));
-    }
+    table.emplace(std::forward<KeyType>(key),std::forward<ValueTypes>(values)...);
   }
 
   template<typename TableType, typename KeyType>
   static inline typename TableType::mapped_type& invoke(TableType& table, KeyType&& key){
-    return table[std::forward<KeyType>(key)];
+    return table.at(std::forward<KeyType>(key));
+  }
+
+  template<typename MatrixType>
+  static inline MatrixType& invoke(MatrixType& matrix){
+    return matrix;
   }
 
   template<typename MatrixType>
@@ -157,17 +162,24 @@ protected:
 
 class FlushIntermediates{
 protected:
+  using allocator = PoolAllocator;
+
   template<typename TableType, typename KeyType, typename... ValueTypes>
   static void init(TableType& table, KeyType&& key, ValueTypes&&... values){
-    if (table.find(key) == table.end()){
-      table.emplace(std::piecewise_construct,std::forward_as_tuple(std::forward<KeyType>(key)),std::forward_as_tuple(std::forward<ValueTypes>(values)...,true));
-    }
+    table.emplace(std::forward<KeyType>(key),std::forward<ValueTypes>(values)...,true);
   }
 
   template<typename TableType, typename KeyType>
   static inline typename TableType::mapped_type& invoke(TableType& table, KeyType&& key){
-    table[std::forward<KeyType>(key)]._fill_();
-    return table[std::forward<KeyType>(key)];
+    auto& buffer = table.at(std::forward<KeyType>(key));
+    buffer._fill_();
+    return buffer;
+  }
+
+  template<typename MatrixType>
+  static inline MatrixType& invoke(MatrixType& matrix){
+    matrix._fill_();
+    return matrix;
   }
 
   template<typename MatrixType>
@@ -177,6 +189,22 @@ protected:
 };
 // ***********************************************************************************************************************************************************************
 
+// ***********************************************************************************************************************************************************************
+class FullPrecision{
+protected:
+  template<typename ScalarType>
+  using sweep_type = ScalarType;
+};
+
+class MixedPrecision{
+protected:
+  // The first sweep's Gram matrix and cholesky-inverse factorization run in single precision; Q is formed from them in ScalarType,
+  //   and every later sweep runs in ScalarType to restore orthogonality. Only takes effect if num_iter>1.
+  template<typename ScalarType>
+  using sweep_type = typename std::conditional<is_complex<ScalarType>::value,std::complex<float>,float>::type;
+};
+// ***********************************************************************************************************************************************************************
+
 };
 };
 };
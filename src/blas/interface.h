@@ -62,6 +62,18 @@ public:
   template<typename T>
   static void _trmm(T* matrixA, T* matrixB, int64_t m, int64_t n, int64_t lda, int64_t ldb, const ArgPack_trmm<T>& srcPackage);
 
+  // trmm with an upper-triangular A in Rectangular Full Packed storage (see rfp in matrix/structure.h), as a sequence of dense trmm/gemm calls on its blocks
+  template<typename T>
+  static void _trmm_rfp(T* matrixA, T* matrixB, int64_t m, int64_t n, int64_t ldb, const ArgPack_trmm<T>& srcPackage);
+
+  // gemm on operands in tile-major storage with tile dimension tile (see tiled in matrix/structure.h), as one dense gemm per (C tile, K tile) pair
+  template<typename T>
+  static void _gemm_tiled(T* matrixA, T* matrixB, T* matrixC, int64_t m, int64_t n, int64_t k, int64_t tile, const ArgPack_gemm<T>& srcPackage);
+
+  // gemm that forms only the uplo triangle (diagonal included) of the n x n matrix C, in column blocks so that the other triangle costs no flops
+  template<typename T>
+  static void _gemmt(T* matrixA, T* matrixB, T* matrixC, int64_t n, int64_t k, int64_t lda, int64_t ldb, int64_t ldc, UpLo uplo, const ArgPack_gemm<T>& srcPackage);
+
   template<typename T>
   static void _syrk(T* matrixA, T* matrixC, int64_t n, int64_t k, int64_t lda, int64_t ldc, const ArgPack_syrk<T>& srcPackage);
 };
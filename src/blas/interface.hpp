@@ -10,8 +10,8 @@ void helper::setInfoParameters_gemm(const ArgPack_gemm<T>& srcPackage,
   // Lots of branches :( --> I can use tertiary operator ?, which is much cheaper than an if/else statements
 
   destArg1 = (srcPackage.order == Order::AblasRowMajor ? CblasRowMajor : CblasColMajor);
-  destArg2 = (srcPackage.transposeA == Transpose::AblasTrans ? CblasTrans : CblasNoTrans);
-  destArg3 = (srcPackage.transposeB == Transpose::AblasTrans ? CblasTrans : CblasNoTrans);
+  destArg2 = (srcPackage.transposeA == Transpose::AblasTrans ? (is_complex<T>::value ? CblasConjTrans : CblasTrans) : CblasNoTrans);
+  destArg3 = (srcPackage.transposeB == Transpose::AblasTrans ? (is_complex<T>::value ? CblasConjTrans : CblasTrans) : CblasNoTrans);
 }
 
 template<typename T>
@@ -25,7 +25,7 @@ void helper::setInfoParameters_trmm(const ArgPack_trmm<T>& srcPackage,
   destArg1 = (srcPackage.order == Order::AblasRowMajor ? CblasRowMajor : CblasColMajor);
   destArg2 = (srcPackage.side == Side::AblasLeft ? CblasLeft : CblasRight);
   destArg3 = (srcPackage.uplo == UpLo::AblasLower ? CblasLower : CblasUpper);
-  destArg4 = (srcPackage.transposeA == Transpose::AblasTrans ? CblasTrans : CblasNoTrans);
+  destArg4 = (srcPackage.transposeA == Transpose::AblasTrans ? (is_complex<T>::value ? CblasConjTrans : CblasTrans) : CblasNoTrans);
   destArg5 = (srcPackage.diag == Diag::AblasUnit ? CblasUnit : CblasNonUnit);
 }
 
@@ -37,7 +37,7 @@ void helper::setInfoParameters_syrk(const ArgPack_syrk<T>& srcPackage,
                                    ){
   destArg1 = (srcPackage.order == Order::AblasRowMajor ? CblasRowMajor : CblasColMajor);
   destArg2 = (srcPackage.uplo == UpLo::AblasLower ? CblasLower : CblasUpper);
-  destArg3 = (srcPackage.transposeA == Transpose::AblasTrans ? CblasTrans : CblasNoTrans);
+  destArg3 = (srcPackage.transposeA == Transpose::AblasTrans ? (is_complex<T>::value ? CblasConjTrans : CblasTrans) : CblasNoTrans);
 }
 
 template<>
@@ -95,4 +95,269 @@ CRITTER_START(syrk);
 CRITTER_STOP(syrk);
 #endif
 }
+
+template<>
+void engine::_gemm(float* matrixA, float* matrixB, float* matrixC, int64_t m, int64_t n, int64_t k, int64_t lda, int64_t ldb, int64_t ldc, const ArgPack_gemm<float>& srcPackage){
+  // First, unpack the info parameter
+  CBLAS_ORDER arg1;
+  CBLAS_TRANSPOSE arg2;
+  CBLAS_TRANSPOSE arg3;
+  setInfoParameters_gemm(srcPackage, arg1, arg2, arg3);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(gemm);
+#endif
+  cblas_sgemm(arg1, arg2, arg3, m, n, k, srcPackage.alpha,
+    matrixA, lda, matrixB, ldb, srcPackage.beta, matrixC, ldc);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(gemm);
+#endif
+}
+
+template<>
+void engine::_trmm(float* matrixA, float* matrixB, int64_t m, int64_t n, int64_t lda, int64_t ldb, const ArgPack_trmm<float>& srcPackage){
+  // First, unpack the info parameter
+  CBLAS_ORDER arg1;
+  CBLAS_SIDE arg2;
+  CBLAS_UPLO arg3;
+  CBLAS_TRANSPOSE arg4;
+  CBLAS_DIAG arg5;
+  setInfoParameters_trmm(srcPackage, arg1, arg2, arg3, arg4, arg5);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(trmm);
+#endif
+  cblas_strmm(arg1, arg2, arg3, arg4, arg5, m, n, srcPackage.alpha, matrixA,
+    lda, matrixB, ldb);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(trmm);
+#endif
+}
+
+template<>
+void engine::_syrk(float* matrixA, float* matrixC, int64_t n, int64_t k, int64_t lda, int64_t ldc, const ArgPack_syrk<float>& srcPackage){
+  // First, unpack the info parameter
+  CBLAS_ORDER arg1;
+  CBLAS_UPLO arg2;
+  CBLAS_TRANSPOSE arg3;
+  setInfoParameters_syrk(srcPackage, arg1, arg2, arg3);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(syrk);
+#endif
+  cblas_ssyrk(arg1, arg2, arg3, n, k, srcPackage.alpha, matrixA,
+    lda, srcPackage.beta, matrixC, ldc);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(syrk);
+#endif
+}
+
+template<>
+void engine::_gemm(std::complex<float>* matrixA, std::complex<float>* matrixB, std::complex<float>* matrixC, int64_t m, int64_t n, int64_t k, int64_t lda, int64_t ldb, int64_t ldc, const ArgPack_gemm<std::complex<float>>& srcPackage){
+  // First, unpack the info parameter
+  CBLAS_ORDER arg1;
+  CBLAS_TRANSPOSE arg2;
+  CBLAS_TRANSPOSE arg3;
+  setInfoParameters_gemm(srcPackage, arg1, arg2, arg3);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(gemm);
+#endif
+  cblas_cgemm(arg1, arg2, arg3, m, n, k, &srcPackage.alpha,
+    matrixA, lda, matrixB, ldb, &srcPackage.beta, matrixC, ldc);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(gemm);
+#endif
+}
+
+template<>
+void engine::_trmm(std::complex<float>* matrixA, std::complex<float>* matrixB, int64_t m, int64_t n, int64_t lda, int64_t ldb, const ArgPack_trmm<std::complex<float>>& srcPackage){
+  // First, unpack the info parameter
+  CBLAS_ORDER arg1;
+  CBLAS_SIDE arg2;
+  CBLAS_UPLO arg3;
+  CBLAS_TRANSPOSE arg4;
+  CBLAS_DIAG arg5;
+  setInfoParameters_trmm(srcPackage, arg1, arg2, arg3, arg4, arg5);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(trmm);
+#endif
+  cblas_ctrmm(arg1, arg2, arg3, arg4, arg5, m, n, &srcPackage.alpha, matrixA,
+    lda, matrixB, ldb);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(trmm);
+#endif
+}
+
+template<>
+void engine::_syrk(std::complex<float>* matrixA, std::complex<float>* matrixC, int64_t n, int64_t k, int64_t lda, int64_t ldc, const ArgPack_syrk<std::complex<float>>& srcPackage){
+  // First, unpack the info parameter
+  CBLAS_ORDER arg1;
+  CBLAS_UPLO arg2;
+  CBLAS_TRANSPOSE arg3;
+  setInfoParameters_syrk(srcPackage, arg1, arg2, arg3);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(syrk);
+#endif
+  // Hermitian rank-k update: alpha and beta must be real
+  cblas_cherk(arg1, arg2, arg3, n, k, srcPackage.alpha.real(), matrixA,
+    lda, srcPackage.beta.real(), matrixC, ldc);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(syrk);
+#endif
+}
+
+template<>
+void engine::_gemm(std::complex<double>* matrixA, std::complex<double>* matrixB, std::complex<double>* matrixC, int64_t m, int64_t n, int64_t k, int64_t lda, int64_t ldb, int64_t ldc, const ArgPack_gemm<std::complex<double>>& srcPackage){
+  // First, unpack the info parameter
+  CBLAS_ORDER arg1;
+  CBLAS_TRANSPOSE arg2;
+  CBLAS_TRANSPOSE arg3;
+  setInfoParameters_gemm(srcPackage, arg1, arg2, arg3);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(gemm);
+#endif
+  cblas_zgemm(arg1, arg2, arg3, m, n, k, &srcPackage.alpha,
+    matrixA, lda, matrixB, ldb, &srcPackage.beta, matrixC, ldc);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(gemm);
+#endif
+}
+
+template<>
+void engine::_trmm(std::complex<double>* matrixA, std::complex<double>* matrixB, int64_t m, int64_t n, int64_t lda, int64_t ldb, const ArgPack_trmm<std::complex<double>>& srcPackage){
+  // First, unpack the info parameter
+  CBLAS_ORDER arg1;
+  CBLAS_SIDE arg2;
+  CBLAS_UPLO arg3;
+  CBLAS_TRANSPOSE arg4;
+  CBLAS_DIAG arg5;
+  setInfoParameters_trmm(srcPackage, arg1, arg2, arg3, arg4, arg5);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(trmm);
+#endif
+  cblas_ztrmm(arg1, arg2, arg3, arg4, arg5, m, n, &srcPackage.alpha, matrixA,
+    lda, matrixB, ldb);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(trmm);
+#endif
+}
+
+template<>
+void engine::_syrk(std::complex<double>* matrixA, std::complex<double>* matrixC, int64_t n, int64_t k, int64_t lda, int64_t ldc, const ArgPack_syrk<std::complex<double>>& srcPackage){
+  // First, unpack the info parameter
+  CBLAS_ORDER arg1;
+  CBLAS_UPLO arg2;
+  CBLAS_TRANSPOSE arg3;
+  setInfoParameters_syrk(srcPackage, arg1, arg2, arg3);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(syrk);
+#endif
+  // Hermitian rank-k update: alpha and beta must be real
+  cblas_zherk(arg1, arg2, arg3, n, k, srcPackage.alpha.real(), matrixA,
+    lda, srcPackage.beta.real(), matrixC, ldc);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(syrk);
+#endif
+}
+
+template<typename T>
+void engine::_trmm_rfp(T* matrixA, T* matrixB, int64_t m, int64_t n, int64_t ldb, const ArgPack_trmm<T>& srcPackage){
+  assert(srcPackage.uplo == UpLo::AblasUpper);
+  // A = [T11 T12; 0 T22], with T11 held as its (lower-triangular) transpose
+  int64_t dimA = (srcPackage.side == Side::AblasLeft ? m : n); int64_t n1 = dimA/2; int64_t n2 = dimA-n1;
+  int64_t lda = (dimA%2 ? dimA : dimA+1);
+  T* T12 = matrixA; T* T22 = matrixA+n1; T* T11t = matrixA+n1+1;
+  bool trans = (srcPackage.transposeA == Transpose::AblasTrans);
+  ArgPack_trmm<T> upperArgs(srcPackage.order, srcPackage.side, UpLo::AblasUpper, srcPackage.transposeA, srcPackage.diag, srcPackage.alpha);
+  ArgPack_trmm<T> lowerArgs(srcPackage.order, srcPackage.side, UpLo::AblasLower, trans ? Transpose::AblasNoTrans : Transpose::AblasTrans, srcPackage.diag, srcPackage.alpha);
+  if (srcPackage.side == Side::AblasLeft){
+    // B = [B1;B2], B1 holding the first n1 rows
+    T* B1 = matrixB; T* B2 = matrixB+n1;
+    if (!trans){
+      // B1 <- T11*B1 + T12*B2, then B2 <- T22*B2
+      ArgPack_gemm<T> gemmArgs(srcPackage.order, Transpose::AblasNoTrans, Transpose::AblasNoTrans, srcPackage.alpha, 1.);
+      if (n1>0) _trmm(T11t, B1, n1, n, lda, ldb, lowerArgs);
+      if (n1>0) _gemm(T12, B2, B1, n1, n, n2, lda, ldb, ldb, gemmArgs);
+      _trmm(T22, B2, n2, n, lda, ldb, upperArgs);
+    }
+    else{
+      // B2 <- T22^T*B2 + T12^T*B1, then B1 <- T11^T*B1
+      ArgPack_gemm<T> gemmArgs(srcPackage.order, Transpose::AblasTrans, Transpose::AblasNoTrans, srcPackage.alpha, 1.);
+      _trmm(T22, B2, n2, n, lda, ldb, upperArgs);
+      if (n1>0) _gemm(T12, B1, B2, n2, n, n1, lda, ldb, ldb, gemmArgs);
+      if (n1>0) _trmm(T11t, B1, n1, n, lda, ldb, lowerArgs);
+    }
+  }
+  else{
+    // B = [B1 B2], B1 holding the first n1 columns
+    T* B1 = matrixB; T* B2 = matrixB+n1*ldb;
+    if (!trans){
+      // B2 <- B2*T22 + B1*T12, then B1 <- B1*T11
+      ArgPack_gemm<T> gemmArgs(srcPackage.order, Transpose::AblasNoTrans, Transpose::AblasNoTrans, srcPackage.alpha, 1.);
+      _trmm(T22, B2, m, n2, lda, ldb, upperArgs);
+      if (n1>0) _gemm(B1, T12, B2, m, n2, n1, ldb, lda, ldb, gemmArgs);
+      if (n1>0) _trmm(T11t, B1, m, n1, lda, ldb, lowerArgs);
+    }
+    else{
+      // B1 <- B1*T11^T + B2*T12^T, then B2 <- B2*T22^T
+      ArgPack_gemm<T> gemmArgs(srcPackage.order, Transpose::AblasNoTrans, Transpose::AblasTrans, srcPackage.alpha, 1.);
+      if (n1>0) _trmm(T11t, B1, m, n1, lda, ldb, lowerArgs);
+      if (n1>0) _gemm(B2, T12, B1, m, n1, n2, ldb, lda, ldb, gemmArgs);
+      _trmm(T22, B2, m, n2, lda, ldb, upperArgs);
+    }
+  }
+}
+
+template<typename T>
+void engine::_gemmt(T* matrixA, T* matrixB, T* matrixC, int64_t n, int64_t k, int64_t lda, int64_t ldb, int64_t ldc, UpLo uplo, const ArgPack_gemm<T>& srcPackage){
+  constexpr int64_t block = 64;
+  bool transA = (srcPackage.transposeA != Transpose::AblasNoTrans); bool transB = (srcPackage.transposeB != Transpose::AblasNoTrans);
+  // Row i of op(A) and column j of op(B)
+  auto rowA = [&](int64_t i){ return matrixA + (transA ? i*lda : i); };
+  auto colB = [&](int64_t j){ return matrixB + (transB ? j : j*ldb); };
+  // Each diagonal block is one square gemm into diag, of which only the uplo triangle is kept
+  ArgPack_gemm<T> diagArgs(srcPackage.order, srcPackage.transposeA, srcPackage.transposeB, srcPackage.alpha, 0.);
+  std::vector<T> diag(std::min(n,block)*std::min(n,block));
+  for (int64_t j0=0; j0<n; j0+=block){
+    int64_t j1 = std::min(n,j0+block); int64_t b = j1-j0;
+    _gemm(rowA(j0), colB(j0), &diag[0], b, b, k, lda, ldb, b, diagArgs);
+    for (int64_t j=0; j<b; j++){
+      int64_t i0 = (uplo == UpLo::AblasUpper ? 0 : j); int64_t i1 = (uplo == UpLo::AblasUpper ? j+1 : b);
+      T* column = matrixC+(j0+j)*ldc+j0;
+      for (int64_t i=i0; i<i1; i++){ column[i] = diag[j*b+i] + (srcPackage.beta == T(0) ? T(0) : srcPackage.beta*column[i]); }
+    }
+    // The off-diagonal part of the column block is a single gemm
+    if ((uplo == UpLo::AblasUpper) && (j0>0)) _gemm(rowA(0), colB(j0), matrixC+j0*ldc, j0, b, k, lda, ldb, ldc, srcPackage);
+    if ((uplo != UpLo::AblasUpper) && (j1<n)) _gemm(rowA(j1), colB(j0), matrixC+j0*ldc+j1, n-j1, b, k, lda, ldb, ldc, srcPackage);
+  }
+}
+
+template<typename T>
+void engine::_gemm_tiled(T* matrixA, T* matrixB, T* matrixC, int64_t m, int64_t n, int64_t k, int64_t tile, const ArgPack_gemm<T>& srcPackage){
+  // Tile (ti,tj) of a rows x cols tiled block starts after tj full tile columns and ti tiles of its own tile column, and has leading dimension equal to its height
+  auto extent = [tile](int64_t t, int64_t dim){ return std::min(tile, dim-t*tile); };
+  auto tile_ptr = [tile,&extent](T* base, int64_t ti, int64_t tj, int64_t rows, int64_t cols){ return base + tj*tile*rows + ti*tile*extent(tj,cols); };
+  bool transA = (srcPackage.transposeA != Transpose::AblasNoTrans); bool transB = (srcPackage.transposeB != Transpose::AblasNoTrans);
+  int64_t rowsA = (transA ? k : m); int64_t colsA = (transA ? m : k); int64_t rowsB = (transB ? n : k); int64_t colsB = (transB ? k : n);
+  int64_t tilesM = (m+tile-1)/tile; int64_t tilesN = (n+tile-1)/tile; int64_t tilesK = (k+tile-1)/tile;
+  ArgPack_gemm<T> tileArgs(srcPackage.order, srcPackage.transposeA, srcPackage.transposeB, srcPackage.alpha, srcPackage.beta);
+  for (int64_t tj=0; tj<tilesN; tj++){
+    for (int64_t ti=0; ti<tilesM; ti++){
+      int64_t tileM = extent(ti,m); int64_t tileN = extent(tj,n);
+      T* tileC = tile_ptr(matrixC,ti,tj,m,n);
+      for (int64_t tk=0; tk<tilesK; tk++){
+        int64_t ai = (transA ? tk : ti); int64_t aj = (transA ? ti : tk); int64_t bi = (transB ? tj : tk); int64_t bj = (transB ? tk : tj);
+        tileArgs.beta = (tk==0 ? srcPackage.beta : T(1.));
+        _gemm(tile_ptr(matrixA,ai,aj,rowsA,colsA), tile_ptr(matrixB,bi,bj,rowsB,colsB), tileC, tileM, tileN, extent(tk,k),
+              extent(ai,rowsA), extent(bi,rowsB), tileM, tileArgs);
+      }
+    }
+  }
+}
 }
@@ -5,6 +5,7 @@
 
 // Local includes
 #include "./../util/shared.h"
+#include "./../blas/engine.h"
 
 namespace lapack{
 
@@ -52,6 +53,12 @@ public:
   template<typename T>
   static void _trtri(T* matrixA, int n, int lda, const ArgPack_trtri& srcPackage);
 
+  // potrf and trtri of an upper-triangular, column-major A in one recursive pass: R overwrites the upper triangle of matrixA and R^{-1} is written
+  //   into the upper triangle of matrixAinv (the lower triangles of both are left untouched). Each level inverts its leading block first and uses it
+  //   for the off-diagonal block, as cholinv does across processes, so A is read once and no copy of the full matrix is made.
+  template<typename T>
+  static void _potrf_trtri(T* matrixA, T* matrixAinv, int n, int lda, int ldainv, const ArgPack_potrf& srcPackage);
+
   template<typename T>
   static void _geqrf(T* matrixA, T* tau, int m, int n, int lda, const ArgPack_geqrf& srcPackage);
 
@@ -68,7 +68,7 @@ CRITTER_START(geqrf);
 #endif
   LAPACKE_dgeqrf(arg1, m, n, matrixA, lda, tau);
 #ifdef FUNCTION_SYMBOLS
-CRITTER_STOP(trtri);
+CRITTER_STOP(geqrf);
 #endif
 }
 
@@ -86,4 +86,209 @@ CRITTER_START(orgqr);
 CRITTER_STOP(orgqr);
 #endif
 }
+template<>
+void engine::_potrf(float* matrixA, int n, int lda, const ArgPack_potrf& srcPackage){
+  // First, unpack the info parameter
+  int arg1; char arg2;
+  helper::setInfoParameters_potrf(srcPackage, arg1, arg2);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(potrf);
+#endif
+  LAPACKE_spotrf(arg1, arg2, n, matrixA, lda);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(potrf);
+#endif
+}
+
+template<>
+void engine::_trtri(float* matrixA, int n, int lda, const ArgPack_trtri& srcPackage){
+  // First, unpack the info parameter
+  int arg1; char arg2; char arg3;
+  helper::setInfoParameters_trtri(srcPackage, arg1, arg2, arg3);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(trtri);
+#endif
+  LAPACKE_strtri(arg1, arg2, arg3, n, matrixA, lda);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(trtri);
+#endif
+}
+
+template<>
+void engine::_geqrf(float* matrixA, float* tau, int m, int n, int lda, const ArgPack_geqrf& srcPackage){
+  // First, unpack the info parameter
+  int arg1;
+  helper::setInfoParameters_geqrf(srcPackage, arg1);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(geqrf);
+#endif
+  LAPACKE_sgeqrf(arg1, m, n, matrixA, lda, tau);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(geqrf);
+#endif
+}
+
+template<>
+void engine::_orgqr(float* matrixA, float* tau, int m, int n, int k, int lda, const ArgPack_orgqr& srcPackage){
+  // First, unpack the info parameter
+  int arg1;
+  helper::setInfoParameters_orgqr(srcPackage, arg1);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(orgqr);
+#endif
+  LAPACKE_sorgqr(arg1, m, n, k, matrixA, lda, tau);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(orgqr);
+#endif
+}
+template<>
+void engine::_potrf(std::complex<float>* matrixA, int n, int lda, const ArgPack_potrf& srcPackage){
+  // First, unpack the info parameter
+  int arg1; char arg2;
+  helper::setInfoParameters_potrf(srcPackage, arg1, arg2);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(potrf);
+#endif
+  LAPACKE_cpotrf(arg1, arg2, n, reinterpret_cast<lapack_complex_float*>(matrixA), lda);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(potrf);
+#endif
+}
+
+template<>
+void engine::_trtri(std::complex<float>* matrixA, int n, int lda, const ArgPack_trtri& srcPackage){
+  // First, unpack the info parameter
+  int arg1; char arg2; char arg3;
+  helper::setInfoParameters_trtri(srcPackage, arg1, arg2, arg3);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(trtri);
+#endif
+  LAPACKE_ctrtri(arg1, arg2, arg3, n, reinterpret_cast<lapack_complex_float*>(matrixA), lda);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(trtri);
+#endif
+}
+
+template<>
+void engine::_geqrf(std::complex<float>* matrixA, std::complex<float>* tau, int m, int n, int lda, const ArgPack_geqrf& srcPackage){
+  // First, unpack the info parameter
+  int arg1;
+  helper::setInfoParameters_geqrf(srcPackage, arg1);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(geqrf);
+#endif
+  LAPACKE_cgeqrf(arg1, m, n, reinterpret_cast<lapack_complex_float*>(matrixA), lda, reinterpret_cast<lapack_complex_float*>(tau));
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(geqrf);
+#endif
+}
+
+template<>
+void engine::_orgqr(std::complex<float>* matrixA, std::complex<float>* tau, int m, int n, int k, int lda, const ArgPack_orgqr& srcPackage){
+  // First, unpack the info parameter
+  int arg1;
+  helper::setInfoParameters_orgqr(srcPackage, arg1);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(orgqr);
+#endif
+  LAPACKE_cungqr(arg1, m, n, k, reinterpret_cast<lapack_complex_float*>(matrixA), lda, reinterpret_cast<lapack_complex_float*>(tau));
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(orgqr);
+#endif
+}
+template<>
+void engine::_potrf(std::complex<double>* matrixA, int n, int lda, const ArgPack_potrf& srcPackage){
+  // First, unpack the info parameter
+  int arg1; char arg2;
+  helper::setInfoParameters_potrf(srcPackage, arg1, arg2);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(potrf);
+#endif
+  LAPACKE_zpotrf(arg1, arg2, n, reinterpret_cast<lapack_complex_double*>(matrixA), lda);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(potrf);
+#endif
+}
+
+template<>
+void engine::_trtri(std::complex<double>* matrixA, int n, int lda, const ArgPack_trtri& srcPackage){
+  // First, unpack the info parameter
+  int arg1; char arg2; char arg3;
+  helper::setInfoParameters_trtri(srcPackage, arg1, arg2, arg3);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(trtri);
+#endif
+  LAPACKE_ztrtri(arg1, arg2, arg3, n, reinterpret_cast<lapack_complex_double*>(matrixA), lda);
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(trtri);
+#endif
+}
+
+template<>
+void engine::_geqrf(std::complex<double>* matrixA, std::complex<double>* tau, int m, int n, int lda, const ArgPack_geqrf& srcPackage){
+  // First, unpack the info parameter
+  int arg1;
+  helper::setInfoParameters_geqrf(srcPackage, arg1);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(geqrf);
+#endif
+  LAPACKE_zgeqrf(arg1, m, n, reinterpret_cast<lapack_complex_double*>(matrixA), lda, reinterpret_cast<lapack_complex_double*>(tau));
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(geqrf);
+#endif
+}
+
+template<>
+void engine::_orgqr(std::complex<double>* matrixA, std::complex<double>* tau, int m, int n, int k, int lda, const ArgPack_orgqr& srcPackage){
+  // First, unpack the info parameter
+  int arg1;
+  helper::setInfoParameters_orgqr(srcPackage, arg1);
+
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(orgqr);
+#endif
+  LAPACKE_zungqr(arg1, m, n, k, reinterpret_cast<lapack_complex_double*>(matrixA), lda, reinterpret_cast<lapack_complex_double*>(tau));
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(orgqr);
+#endif
+}
+
+template<typename T>
+void engine::_potrf_trtri(T* matrixA, T* matrixAinv, int n, int lda, int ldainv, const ArgPack_potrf& srcPackage){
+  assert(srcPackage.order == Order::AlapackColumnMajor && srcPackage.uplo == UpLo::AlapackUpper);
+  // Blocks this small fit in cache, so the two unfused routines cost no extra trips to memory
+  if (n <= 64){
+    _potrf(matrixA, n, lda, srcPackage);
+    for (int j=0; j<n; j++){ std::memcpy(&matrixAinv[j*ldainv], &matrixA[j*lda], (j+1)*sizeof(T)); }
+    ArgPack_trtri trtriArgs(srcPackage.order, srcPackage.uplo, Diag::AlapackNonUnit);
+    _trtri(matrixAinv, n, ldainv, trtriArgs);
+    return;
+  }
+  int n1 = n/2; int n2 = n-n1;
+  T* R12 = &matrixA[n1*lda]; T* R22 = &matrixA[n1*lda+n1]; T* Rinv12 = &matrixAinv[n1*ldainv]; T* Rinv22 = &matrixAinv[n1*ldainv+n1];
+  _potrf_trtri(matrixA, matrixAinv, n1, lda, ldainv, srcPackage);
+  // R12 <- R11^{-T}A12, A22 <- A22 - R12^T R12
+  blas::ArgPack_trmm<T> trmmArgs(blas::Order::AblasColumnMajor, blas::Side::AblasLeft, blas::UpLo::AblasUpper, blas::Transpose::AblasTrans, blas::Diag::AblasNonUnit, 1.);
+  blas::engine::_trmm(matrixAinv, R12, n1, n2, ldainv, lda, trmmArgs);
+  blas::ArgPack_syrk<T> syrkArgs(blas::Order::AblasColumnMajor, blas::UpLo::AblasUpper, blas::Transpose::AblasTrans, -1., 1.);
+  blas::engine::_syrk(R12, R22, n2, n1, lda, lda, syrkArgs);
+  _potrf_trtri(R22, Rinv22, n2, lda, ldainv, srcPackage);
+  // Rinv12 <- -R11^{-1} R12 R22^{-1}
+  for (int j=0; j<n2; j++){ std::memcpy(&Rinv12[j*ldainv], &R12[j*lda], n1*sizeof(T)); }
+  blas::ArgPack_trmm<T> leftArgs(blas::Order::AblasColumnMajor, blas::Side::AblasLeft, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, -1.);
+  blas::engine::_trmm(matrixAinv, Rinv12, n1, n2, ldainv, ldainv, leftArgs);
+  blas::ArgPack_trmm<T> rightArgs(blas::Order::AblasColumnMajor, blas::Side::AblasRight, blas::UpLo::AblasUpper, blas::Transpose::AblasNoTrans, blas::Diag::AblasNonUnit, 1.);
+  blas::engine::_trmm(Rinv22, Rinv12, n1, n2, ldainv, ldainv, rightArgs);
+}
 }
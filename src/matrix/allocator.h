@@ -0,0 +1,111 @@
+/* Author: Edward Hutter */
+
+#ifndef MATRIX_ALLOCATOR_H_
+#define MATRIX_ALLOCATOR_H_
+
+// These class policies implement the Allocator Policy, which decides where the _data, _scratch, and _pad buffers of a matrix come from
+
+// Plain heap allocation: every buffer is obtained from and returned to the system heap
+class HeapAllocator{
+public:
+  template<typename ScalarType, typename DimensionType>
+  static ScalarType* _allocate(DimensionType numElems);
+  template<typename ScalarType>
+  static void _deallocate(ScalarType* ptr);
+  template<typename ScalarType, typename DimensionType>
+  static void _zero(ScalarType* ptr, DimensionType numElems);
+};
+
+// Heap allocation aligned to a cache line, so that every column-major buffer starts on a boundary suitable for 512-bit vector loads
+class AlignedAllocator{
+public:
+  template<typename ScalarType, typename DimensionType>
+  static ScalarType* _allocate(DimensionType numElems);
+  template<typename ScalarType>
+  static void _deallocate(ScalarType* ptr);
+  template<typename ScalarType, typename DimensionType>
+  static void _zero(ScalarType* ptr, DimensionType numElems);
+
+  static constexpr size_t _alignment = 64;
+};
+
+// Large buffers are backed by explicit huge pages (MAP_HUGETLB) when the system has them reserved, and otherwise by an anonymous mapping
+//   advised for transparent huge pages. Buffers smaller than a huge page fall back to AlignedAllocator.
+//   Advice is only a hint: whether the kernel promotes an Advised buffer shows up in AnonHugePages of /proc/self/smaps, not here.
+//   A cache-line-sized header in front of each buffer records its size and backing, so user pointers remain 64-byte aligned.
+class HugePageAllocator{
+public:
+  enum class Backing : size_t { Heap, HugeTLB, Advised };
+
+  template<typename ScalarType, typename DimensionType>
+  static ScalarType* _allocate(DimensionType numElems);
+  template<typename ScalarType>
+  static void _deallocate(ScalarType* ptr);
+  template<typename ScalarType, typename DimensionType>
+  static void _zero(ScalarType* ptr, DimensionType numElems);
+  template<typename ScalarType>
+  static Backing _backing(const ScalarType* ptr);
+  static size_t _num_hugetlb_bytes(){ return _counters()[0]; }		// Bytes currently mapped with MAP_HUGETLB
+  static size_t _num_advised_bytes(){ return _counters()[1]; }		// Bytes currently mapped with MADV_HUGEPAGE advice
+
+  static constexpr size_t _huge_page_size = 2*1024*1024;
+
+private:
+  static constexpr size_t _header_size = 64;
+  static size_t* _counters(){ static size_t counters[2] = {0,0}; return counters; }
+};
+
+// Per-process pool: released buffers are cached by byte size and handed back out to later requests of the same size.
+//   The recursive algorithms request identical buffer sizes on every invocation, so repeated factorizations stop touching the heap.
+//   A recycled buffer is zero-filled like a fresh one, since partial writers (e.g. a triangular unpack into a pad) leave the rest of it untouched.
+//   The cache lives as long as some allocator_lease<PoolAllocator> does, and algorithms also empty it when they replan for a new shape.
+//   Not thread-safe; buffers are only ever requested from the thread that owns the MPI rank.
+class PoolAllocator{
+public:
+  template<typename ScalarType, typename DimensionType>
+  static ScalarType* _allocate(DimensionType numElems);
+  template<typename ScalarType>
+  static void _deallocate(ScalarType* ptr);
+  template<typename ScalarType, typename DimensionType>
+  static void _zero(ScalarType* ptr, DimensionType numElems);
+  static void _release();			// Returns every cached buffer to the heap
+  static size_t _num_cached_bytes();
+
+private:
+  template<typename AllocatorPolicy> friend class allocator_lease;
+  static constexpr size_t _header_size = AlignedAllocator::_alignment;	// Keeps the user pointer aligned as well as the underlying allocation
+  static std::map<size_t,std::vector<void*>>& _free_lists(){ static std::map<size_t,std::vector<void*>> lists; return lists; }
+  static size_t& _num_leases(){ static size_t count = 0; return count; }
+};
+
+// Held by the owners of an allocator's buffers (e.g. an algorithm's info, declared ahead of its intermediates so that it outlives them).
+//   Only PoolAllocator keeps anything once its buffers are released: it returns its cache to the heap when the last lease is destroyed, or on release().
+template<typename AllocatorPolicy>
+class allocator_lease{
+public:
+  static void release(){}
+};
+
+template<>
+class allocator_lease<PoolAllocator>{
+public:
+  allocator_lease(){ PoolAllocator::_num_leases()++; }
+  allocator_lease(const allocator_lease& rhs) : allocator_lease() {}
+  allocator_lease& operator=(const allocator_lease& rhs){ return *this; }
+  ~allocator_lease(){ if (--PoolAllocator::_num_leases() == 0) PoolAllocator::_release(); }
+  static void release(){ PoolAllocator::_release(); }
+};
+
+// NUMA placement of matrix buffers. Linux places a page on the node of the thread that first writes it, so buffers are zero-filled
+//   with the same static partitioning that the distribute_* generators and threaded BLAS use when they later sweep the columns.
+class first_touch{
+public:
+  template<typename ScalarType, typename DimensionType>
+  static void _zero(ScalarType* data, DimensionType numElems);
+  // Number of pages of [ptr,ptr+numBytes) resident on each NUMA node. Negative keys are errno values, e.g. -ENOENT for pages never touched.
+  static std::map<int,size_t> _numa_pages(const void* ptr, size_t numBytes);
+};
+
+#include "allocator.hpp"
+
+#endif /* MATRIX_ALLOCATOR_H_ */
@@ -0,0 +1,133 @@
+/* Author: Edward Hutter */
+
+template<typename ScalarType, typename DimensionType>
+ScalarType* HeapAllocator::_allocate(DimensionType numElems){
+  return new ScalarType[numElems];
+}
+
+template<typename ScalarType>
+void HeapAllocator::_deallocate(ScalarType* ptr){
+  delete[] ptr;
+}
+
+template<typename ScalarType, typename DimensionType>
+void HeapAllocator::_zero(ScalarType* ptr, DimensionType numElems){
+  first_touch::_zero(ptr,numElems);
+}
+
+template<typename ScalarType, typename DimensionType>
+ScalarType* AlignedAllocator::_allocate(DimensionType numElems){
+  void* ptr = nullptr;
+  size_t num_bytes = numElems*sizeof(ScalarType); num_bytes = (num_bytes > 0 ? num_bytes : _alignment);
+  int status = posix_memalign(&ptr, _alignment, num_bytes); assert(status == 0);
+  return static_cast<ScalarType*>(ptr);
+}
+
+template<typename ScalarType>
+void AlignedAllocator::_deallocate(ScalarType* ptr){
+  std::free(ptr);
+}
+
+template<typename ScalarType, typename DimensionType>
+void AlignedAllocator::_zero(ScalarType* ptr, DimensionType numElems){
+  first_touch::_zero(ptr,numElems);
+}
+
+template<typename ScalarType, typename DimensionType>
+ScalarType* HugePageAllocator::_allocate(DimensionType numElems){
+  size_t num_bytes = numElems*sizeof(ScalarType) + _header_size;
+  char* block = nullptr; Backing backing = Backing::Heap;
+  if (num_bytes >= _huge_page_size){
+    num_bytes = ((num_bytes + _huge_page_size-1)/_huge_page_size)*_huge_page_size;
+    void* ptr = mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr != MAP_FAILED){ backing = Backing::HugeTLB; _counters()[0] += num_bytes; }
+    else{
+      // No reserved huge pages: fall back to regular pages and ask the kernel to promote them
+      ptr = mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0); assert(ptr != MAP_FAILED);
+#ifdef MADV_HUGEPAGE
+      if (madvise(ptr, num_bytes, MADV_HUGEPAGE) == 0){ backing = Backing::Advised; _counters()[1] += num_bytes; }
+#endif
+      if (backing == Backing::Heap){ munmap(ptr, num_bytes); ptr = nullptr; }
+    }
+    block = static_cast<char*>(ptr);
+  }
+  if (block == nullptr){ backing = Backing::Heap; block = AlignedAllocator::template _allocate<char>(num_bytes); }
+  reinterpret_cast<size_t*>(block)[0] = num_bytes; reinterpret_cast<size_t*>(block)[1] = static_cast<size_t>(backing);
+  return reinterpret_cast<ScalarType*>(block+_header_size);
+}
+
+template<typename ScalarType>
+void HugePageAllocator::_deallocate(ScalarType* ptr){
+  char* block = reinterpret_cast<char*>(ptr)-_header_size;
+  size_t num_bytes = reinterpret_cast<size_t*>(block)[0]; Backing backing = static_cast<Backing>(reinterpret_cast<size_t*>(block)[1]);
+  if (backing == Backing::Heap){ AlignedAllocator::_deallocate(block); return; }
+  _counters()[backing == Backing::HugeTLB ? 0 : 1] -= num_bytes;
+  munmap(block, num_bytes);
+}
+
+template<typename ScalarType, typename DimensionType>
+void HugePageAllocator::_zero(ScalarType* ptr, DimensionType numElems){
+  first_touch::_zero(ptr,numElems);
+}
+
+template<typename ScalarType>
+HugePageAllocator::Backing HugePageAllocator::_backing(const ScalarType* ptr){
+  return static_cast<Backing>(reinterpret_cast<const size_t*>(reinterpret_cast<const char*>(ptr)-_header_size)[1]);
+}
+
+template<typename ScalarType, typename DimensionType>
+ScalarType* PoolAllocator::_allocate(DimensionType numElems){
+  // Round up to the header size so that buffers of nearly equal size share a free list
+  size_t num_bytes = ((numElems*sizeof(ScalarType) + _header_size-1)/_header_size)*_header_size;
+  auto& list = _free_lists()[num_bytes];
+  char* block;
+  if (list.size() > 0){ block = static_cast<char*>(list.back()); list.pop_back(); }
+  else{ block = AlignedAllocator::template _allocate<char>(num_bytes+_header_size); }
+  reinterpret_cast<size_t*>(block)[0] = num_bytes;
+  return reinterpret_cast<ScalarType*>(block+_header_size);
+}
+
+template<typename ScalarType>
+void PoolAllocator::_deallocate(ScalarType* ptr){
+  char* block = reinterpret_cast<char*>(ptr)-_header_size;
+  _free_lists()[*reinterpret_cast<size_t*>(block)].push_back(block);
+}
+
+template<typename ScalarType, typename DimensionType>
+void PoolAllocator::_zero(ScalarType* ptr, DimensionType numElems){
+  first_touch::_zero(ptr,numElems);
+}
+
+inline void PoolAllocator::_release(){
+  for (auto& it : _free_lists()){
+    for (auto block : it.second){ AlignedAllocator::_deallocate(block); }
+    it.second.clear();
+  }
+  _free_lists().clear();
+}
+
+inline size_t PoolAllocator::_num_cached_bytes(){
+  size_t num_bytes = 0;
+  for (auto& it : _free_lists()){ num_bytes += it.first*it.second.size(); }
+  return num_bytes;
+}
+
+template<typename ScalarType, typename DimensionType>
+void first_touch::_zero(ScalarType* data, DimensionType numElems){
+  #pragma omp parallel for schedule(static)
+  for (DimensionType i=0; i<numElems; i++){ data[i] = 0; }
+}
+
+inline std::map<int,size_t> first_touch::_numa_pages(const void* ptr, size_t numBytes){
+  std::map<int,size_t> pages_per_node;
+  if ((ptr == nullptr) || (numBytes == 0)) return pages_per_node;
+  size_t page_size = sysconf(_SC_PAGESIZE);
+  uintptr_t start = reinterpret_cast<uintptr_t>(ptr) & ~(page_size-1);
+  size_t num_pages = (reinterpret_cast<uintptr_t>(ptr) + numBytes - start + page_size-1)/page_size;
+  std::vector<void*> pages(num_pages); std::vector<int> status(num_pages,0);
+  for (size_t i=0; i<num_pages; i++){ pages[i] = reinterpret_cast<void*>(start + i*page_size); }
+  // move_pages with no target nodes only queries where each page currently lives
+  if (syscall(SYS_move_pages, 0, num_pages, pages.data(), nullptr, status.data(), 0) != 0) return pages_per_node;
+  for (auto node : status){ pages_per_node[node]++; }
+  return pages_per_node;
+}
@@ -4,9 +4,11 @@
 #define MATRIX_H_
 
 // Local includes -- the policy classes
+#include "./../util/random.h"
+#include "allocator.h"
 #include "structure.h"
 
-template<typename ScalarT = double, typename DimensionT = int64_t, typename StructurePolicy = rect, typename OffloadPolicy = OffloadEachGemm>
+template<typename ScalarT = double, typename DimensionT = int64_t, typename StructurePolicy = rect, typename OffloadPolicy = OffloadEachGemm, typename AllocatorPolicy = HeapAllocator>
 class matrix : public StructurePolicy{
 public:
   // Type traits (some inherited from matrixBase)
@@ -14,6 +16,7 @@ public:
   using DimensionType = DimensionT;
   using StructureType = StructurePolicy;
   using OffloadType = OffloadPolicy;
+  using AllocatorType = AllocatorPolicy;
 
   explicit matrix(){this->filled=false; this->danger=true; this->_data=nullptr; this->_scratch=nullptr; this->_pad=nullptr;}// = delete;
   explicit matrix(DimensionType globalDimensionX, DimensionType globalDimensionY, int64_t globalPgridX, int64_t globalPgridY);	// Regular constructor
@@ -38,18 +41,25 @@ public:
   inline ScalarType*& data() { return this->_data; }
   inline ScalarType* data() const { return this->_data; }
   //inline ScalarType* get_data() { ScalarType* data = this->_data; this->_data=nullptr; return data; }	// only to be used if internal pointer is needed and instance is never to be used again
-  inline ScalarType*& scratch() { return this->_scratch; }
-  inline ScalarType* scratch() const { return this->_scratch; }
-  inline ScalarType*& pad() { return this->_pad; }
-  inline ScalarType* pad() const { return this->_pad; }
+  // scratch and pad are materialized on first use, as most matrices (and most policies) never touch them
+  inline ScalarType*& scratch() { if (this->_scratch == nullptr){ _materialize(this->_scratch, this->_numElems); } return this->_scratch; }
+  inline ScalarType* scratch() const { return const_cast<matrix*>(this)->scratch(); }
+  inline ScalarType*& pad() { if (this->_pad == nullptr){ _materialize(this->_pad, rect::_num_elems(this->_dimensionX,this->_dimensionY)); } return this->_pad; }
+  inline ScalarType* pad() const { return const_cast<matrix*>(this)->pad(); }
+  inline bool has_scratch() const { return this->_scratch != nullptr; }
+  inline bool has_pad() const { return this->_pad != nullptr; }
+  // NUMA placement of a buffer (0=data, 1=scratch, 2=pad): pages resident per node, and the node holding most of them (-1 if unknown)
+  std::map<int,size_t> numa_pages(size_t buffer=0) const;
+  int numa_node(size_t buffer=0) const;
   inline DimensionType num_elems() const { return this->_numElems; }
-  inline DimensionType num_elems(DimensionType rangeX, DimensionType rangeY) const { return _num_elems(rangeX, rangeY); }
+  inline DimensionType num_elems(DimensionType rangeX, DimensionType rangeY) const { return this->_num_elems(rangeX, rangeY); }
   inline DimensionType num_rows_local() const { return this->_dimensionY; }
   inline DimensionType num_columns_local() const { return this->_dimensionX; }
   inline DimensionType num_rows_global() const { return this->_globalDimensionY; }
   inline DimensionType num_columns_global() const { return this->_globalDimensionX; }
 
-  inline DimensionType offset_local(DimensionType coordX, DimensionType coordY, size_t buffer=0) const { return buffer != 2 ? _offset(coordX,coordY,this->_dimensionX,this->_dimensionY) : rect::_offset(coordX,coordY,this->_dimensionX,this->_dimensionY);}
+  inline DimensionType leading_dimension(size_t buffer=0) const { return this->_dimensionY; }
+  inline DimensionType offset_local(DimensionType coordX, DimensionType coordY, size_t buffer=0) const { return buffer != 2 ? this->_offset(coordX,coordY,this->_dimensionX,this->_dimensionY) : rect::_offset(coordX,coordY,this->_dimensionX,this->_dimensionY);}
 inline DimensionType offset_global(DimensionType coordX, DimensionType coordY) const { assert(0) && "not implemented"; return -1;}//TODO
 
   inline void swap() { ScalarType* ptr = this->data(); this->data() = this->scratch(); this->scratch() = ptr; } 
@@ -74,10 +84,11 @@ inline DimensionType offset_global(DimensionType coordX, DimensionType coordY) c
 private:
   void copy(const matrix& rhs);
   void mover(matrix&& rhs);
+  void _materialize(ScalarType*& buffer, DimensionType numElems);
 
   ScalarType* _data;				// Where the matrix data lives as a contiguous 1d array
-  ScalarType* _scratch;				// Extra storage for summa and other computations that require one2all and all2one communications
-  ScalarType* _pad;				// Extra storage for uppertri and lowertri structures only used in avoiding extra allocations in summa
+  ScalarType* _scratch;				// Extra storage for summa and other computations that require one2all and all2one communications (allocated lazily)
+  ScalarType* _pad;				// Extra storage for uppertri and lowertri structures only used in avoiding extra allocations in summa (allocated lazily)
   bool allocated_data;				// Asks if the raw data was allocated by the user or ourselves
   bool filled;					// Tracks whether the matrix instance has been filled with data in the 2-part construction
   bool danger;					// notifies me if default constructor was used.
@@ -2,8 +2,8 @@
 
 // #include "matrix.h"  -> Compiler needs the full definition of the templated class in order to instantiate it.
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::matrix(DimensionType globalDimensionX, DimensionType globalDimensionY, int64_t globalPgridX, int64_t globalPgridY){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::matrix(DimensionType globalDimensionX, DimensionType globalDimensionY, int64_t globalPgridX, int64_t globalPgridY){
   // Extra padding of zeros is at most 1 in either dimension
   int64_t pHelper = globalDimensionX%globalPgridX;
   this->_dimensionX = {globalDimensionX/globalPgridX + (pHelper ? 1 : 0)};
@@ -13,13 +13,13 @@ matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::matrix(Dimension
   this->_globalDimensionX = {globalDimensionX};
   this->_globalDimensionY = {globalDimensionY};
 
-  _assemble(this->_data, this->_scratch, this->_pad, this->_numElems, this->_dimensionX, this->_dimensionY);
+  StructurePolicy::template _assemble<AllocatorPolicy>(this->_data, this->_scratch, this->_pad, this->_numElems, this->_dimensionX, this->_dimensionY);
   this->allocated_data=true; this->filled=true;
   return;
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::matrix(ScalarType* data, DimensionType dimensionX, DimensionType dimensionY, DimensionType globalDimensionX, DimensionType globalDimensionY, DimensionType globalPgridX, DimensionType globalPgridY){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::matrix(ScalarType* data, DimensionType dimensionX, DimensionType dimensionY, DimensionType globalDimensionX, DimensionType globalDimensionY, DimensionType globalPgridX, DimensionType globalPgridY){
   // Idea: move the data argument into this_data, and then set up the matrix rows (this_matrix)
   // Note that the owner of data and positions should be aware that the vectors they pass in will be destroyed and the data sucked out upon return.
 
@@ -38,19 +38,19 @@ matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::matrix(ScalarTyp
   // Reason: sometimes, I just want to enter in an empty vector that will be filled up in Serializer. Other times, I want to truly
   //   assemble a vector for use somewhere else.
   if ((this->_data == nullptr) || (!valid)){
-    _assemble(this->_data, this->_scratch, this->_pad, this->_numElems, dimensionX, dimensionY);
+    StructurePolicy::template _assemble<AllocatorPolicy>(this->_data, this->_scratch, this->_pad, this->_numElems, dimensionX, dimensionY);
     this->allocated_data=true;
   }
   else{
     // No longer supporting cheap copies if pointer is valid, because the algorithm internals take extreme liberties in optimizations
-    _copy(this->_data, this->_scratch, this->_pad, data, this->_dimensionX, this->_dimensionY);
+    StructurePolicy::template _copy<AllocatorPolicy>(this->_data, this->_scratch, this->_pad, data, this->_dimensionX, this->_dimensionY);
     this->allocated_data=true;
   }
   this->filled=true;
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::matrix(ScalarType* data, DimensionType dimensionX, DimensionType dimensionY, DimensionType globalPgridX, DimensionType globalPgridY){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::matrix(ScalarType* data, DimensionType dimensionX, DimensionType dimensionY, DimensionType globalPgridX, DimensionType globalPgridY){
   // Idea: move the data argument into this_data, and then set up the matrix rows (this_matrix)
   // Note that the owner of data and positions should be aware that the vectors they pass in will be destroyed and the data sucked out upon return.
 
@@ -63,45 +63,46 @@ matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::matrix(ScalarTyp
   this->_data = data;					// will get overwritten if necessary
 
   if (data != nullptr){
-    _assemble_matrix(this->_data, this->_scratch, this->_pad, this->_dimensionX, this->_dimensionY);
+    StructurePolicy::template _assemble_matrix<AllocatorPolicy>(this->_data, this->_scratch, this->_pad, this->_dimensionX, this->_dimensionY);
     this->allocated_data=false;
   }
   else{
-    _assemble(this->_data, this->_scratch, this->_pad, this->_numElems, this->_dimensionX, this->_dimensionY);
+    StructurePolicy::template _assemble<AllocatorPolicy>(this->_data, this->_scratch, this->_pad, this->_numElems, this->_dimensionX, this->_dimensionY);
     this->allocated_data=true;
   }
   this->filled=true;
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::matrix(ScalarType* data, DimensionType dimensionX, DimensionType dimensionY, DimensionType globalPgridX, DimensionType globalPgridY, bool){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::matrix(ScalarType* data, DimensionType dimensionX, DimensionType dimensionY, DimensionType globalPgridX, DimensionType globalPgridY, bool){
   this->_dimensionX = {dimensionX};
   this->_dimensionY = {dimensionY};
   this->_globalDimensionX = {dimensionX*globalPgridX};
   this->_globalDimensionY = {dimensionY*globalPgridY};
   this->_numElems = num_elems(dimensionX, dimensionY);	// will get overwritten if necessary
   this->_data = data;					// will get overwritten if necessary
+  this->_scratch = nullptr; this->_pad = nullptr;
   this->allocated_data=false;
   this->filled=false;
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::matrix(const matrix& rhs){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::matrix(const matrix& rhs){
   copy(rhs);
   this->filled=true;
   return;
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::matrix(matrix&& rhs){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::matrix(matrix&& rhs){
   // DimensionTypese std::forward in the future.
   mover(std::move(rhs));
   this->filled=true;
   return;
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>& matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::operator=(const matrix& rhs){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>& matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::operator=(const matrix& rhs){
   if (this != &rhs){
     copy(rhs);
   }
@@ -109,8 +110,8 @@ matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>& matrix<ScalarTyp
   return *this;
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>& matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::operator=(matrix&& rhs){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>& matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::operator=(matrix&& rhs){
   if (this != &rhs){
     mover(std::move(rhs));
   }
@@ -118,28 +119,28 @@ matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>& matrix<ScalarTyp
   return *this;
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::~matrix(){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::~matrix(){
   this->_destroy_();
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::_fill_(){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::_fill_(){
   if (!this->filled){
     if (this->_data != nullptr){
-      _assemble_matrix(this->_data, this->_scratch, this->_pad, this->_dimensionX, this->_dimensionY);
+      StructurePolicy::template _assemble_matrix<AllocatorPolicy>(this->_data, this->_scratch, this->_pad, this->_dimensionX, this->_dimensionY);
       this->allocated_data=false;
     }
     else{
-      _assemble(this->_data, this->_scratch, this->_pad, this->_numElems, this->_dimensionX, this->_dimensionY);
+      StructurePolicy::template _assemble<AllocatorPolicy>(this->_data, this->_scratch, this->_pad, this->_numElems, this->_dimensionX, this->_dimensionY);
       this->allocated_data=true;
     }
     this->filled=true;
   }
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::_register_(DimensionType globalDimensionX, DimensionType globalDimensionY, int64_t globalPgridX, int64_t globalPgridY){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::_register_(DimensionType globalDimensionX, DimensionType globalDimensionY, int64_t globalPgridX, int64_t globalPgridY){
   if (!this->filled){
     // Extra padding of zeros is at most 1 in either dimension
     int64_t pHelper = globalDimensionX%globalPgridX;
@@ -154,46 +155,47 @@ void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::_register_(
   }
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::_destroy_(){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::_destroy_(){
   // Actually, now that we are purly using vectors, I don't think we need to delete anything. Once the instance
   //   of the class goes out of scope, the vector data gets deleted automatically.
+  // scratch and pad may have been materialized even if the matrix was never filled
+  if (this->_scratch != nullptr){ AllocatorPolicy::_deallocate(this->_scratch); this->_scratch=nullptr;}
+  if (this->_pad != nullptr){ AllocatorPolicy::_deallocate(this->_pad); this->_pad=nullptr;}
   if (this->filled){
-    if (this->_scratch != nullptr){ delete[] this->_scratch; this->_scratch=nullptr;}	// could add an assert here for StructurePolicy==lowertri,uppertri
-    if (this->_pad != nullptr){ delete[] this->_pad; this->_pad=nullptr;}	// could add an assert here for StructurePolicy==lowertri,uppertri
-    if (this->allocated_data && (this->_data != nullptr)){ delete[] this->_data; this->_data=nullptr;}
+    if (this->allocated_data && (this->_data != nullptr)){ AllocatorPolicy::_deallocate(this->_data); this->_data=nullptr;}
     this->allocated_data=false;
     this->filled=false;
   }
   this->filled=false;
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::_restrict_(DimensionType startX, DimensionType endX, DimensionType startY, DimensionType endY){
-  this->_data_=this->_data; this->_scratch_=this->_scratch; this->_dimensionX_=this->_dimensionX; this->_dimensionY_=this->_dimensionY; this->_numElems_=this->_numElems;
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::_restrict_(DimensionType startX, DimensionType endX, DimensionType startY, DimensionType endY){
+  this->_data_=this->_data; this->_scratch_=this->scratch(); this->_dimensionX_=this->_dimensionX; this->_dimensionY_=this->_dimensionY; this->_numElems_=this->_numElems;
   this->_data=&this->_data_[offset_local(startX,startY)]; this->_scratch=&this->_scratch_[offset_local(startX,startY)]; this->_dimensionX=endX-startX; this->_dimensionY=endY-startY; this->_numElems=num_elems(endX-startX,endY-startY);
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::_derestrict_(){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::_derestrict_(){
   this->_data=this->_data_; this->_scratch=this->_scratch_; this->_dimensionX=this->_dimensionX_; this->_dimensionY=this->_dimensionY_; this->_numElems=this->_numElems_;
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::copy(const matrix& rhs){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::copy(const matrix& rhs){
   this->_dimensionX = {rhs._dimensionX};
   this->_dimensionY = {rhs._dimensionY};
   this->_numElems = {rhs._numElems};
   this->_globalDimensionX = {rhs._globalDimensionX};
   this->_globalDimensionY = {rhs._globalDimensionY};
-  _copy(this->_data, this->_scratch, this->_pad, rhs._data, this->_dimensionX, this->_dimensionY);
+  StructurePolicy::template _copy<AllocatorPolicy>(this->_data, this->_scratch, this->_pad, rhs._data, this->_dimensionX, this->_dimensionY);
   this->allocated_data=true;
   this->filled=true;
   return;
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::mover(matrix&& rhs){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::mover(matrix&& rhs){
   assert(rhs.allocated_data);	// we don't support "move"ing from pointer-generated matrix instances
   this->_dimensionX = {rhs._dimensionX};
   this->_dimensionY = {rhs._dimensionY};
@@ -210,46 +212,66 @@ void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::mover(matri
   return;
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::distribute_random(int64_t localPgridX, int64_t localPgridY, int64_t globalPgridX, int64_t globalPgridY, int64_t key){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::_materialize(ScalarType*& buffer, DimensionType numElems){
+  buffer = AllocatorPolicy::template _allocate<ScalarType>(numElems);
+  AllocatorPolicy::_zero(buffer,numElems);
+}
+
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+std::map<int,size_t> matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::numa_pages(size_t buffer) const{
+  if (buffer==0) return first_touch::_numa_pages(this->_data, this->_numElems*sizeof(ScalarType));
+  else if (buffer==1) return first_touch::_numa_pages(this->_scratch, this->_numElems*sizeof(ScalarType));
+  else return first_touch::_numa_pages(this->_pad, rect::_num_elems(this->_dimensionX,this->_dimensionY)*sizeof(ScalarType));
+}
+
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+int matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::numa_node(size_t buffer) const{
+  int node = -1; size_t max_pages = 0;
+  for (auto& it : numa_pages(buffer)){ if ((it.first >= 0) && (it.second > max_pages)){ node = it.first; max_pages = it.second; } }
+  return node;
+}
+
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::distribute_random(int64_t localPgridX, int64_t localPgridY, int64_t globalPgridX, int64_t globalPgridY, int64_t key){
   // matrix must be already constructed with memory. Add a check for this later.
-  _distribute_random(this->_data,this->_dimensionX,this->_dimensionY,this->_globalDimensionX,this->_globalDimensionY,localPgridX,localPgridY,globalPgridX,globalPgridY,key);
+  this->_distribute_random(this->_data,this->_dimensionX,this->_dimensionY,this->_globalDimensionX,this->_globalDimensionY,localPgridX,localPgridY,globalPgridX,globalPgridY,key);
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::distribute_symmetric(int64_t localPgridX, int64_t localPgridY, int64_t globalPgridX, int64_t globalPgridY, int64_t key, bool diagonallyDominant){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::distribute_symmetric(int64_t localPgridX, int64_t localPgridY, int64_t globalPgridX, int64_t globalPgridY, int64_t key, bool diagonallyDominant){
   // matrix must be already constructed with memory. Add a check for this later.
-  _distribute_symmetric(this->_data,this->_dimensionX,this->_dimensionY,this->_globalDimensionX,this->_globalDimensionY,localPgridX,localPgridY,globalPgridX,globalPgridY,key,diagonallyDominant);
+  this->_distribute_symmetric(this->_data,this->_dimensionX,this->_dimensionY,this->_globalDimensionX,this->_globalDimensionY,localPgridX,localPgridY,globalPgridX,globalPgridY,key,diagonallyDominant);
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::distribute_identity(int64_t localPgridX, int64_t localPgridY, int64_t globalPgridX, int64_t globalPgridY, ScalarType val){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::distribute_identity(int64_t localPgridX, int64_t localPgridY, int64_t globalPgridX, int64_t globalPgridY, ScalarType val){
   // matrix must be already constructed with memory. Add a check for this later.
-  _distribute_identity(this->_data,this->_dimensionX,this->_dimensionY,this->_globalDimensionX,this->_globalDimensionY,localPgridX,localPgridY,globalPgridX,globalPgridY,val);
+  this->_distribute_identity(this->_data,this->_dimensionX,this->_dimensionY,this->_globalDimensionX,this->_globalDimensionY,localPgridX,localPgridY,globalPgridX,globalPgridY,val);
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::distribute_debug(int64_t localPgridX, int64_t localPgridY, int64_t globalPgridX, int64_t globalPgridY){
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::distribute_debug(int64_t localPgridX, int64_t localPgridY, int64_t globalPgridX, int64_t globalPgridY){
   // matrix must be already constructed with memory. Add a check for this later.
   _distribute_debug(this->_data,this->_dimensionX,this->_dimensionY,this->_globalDimensionX,this->_globalDimensionY,localPgridX,localPgridY,globalPgridX,globalPgridY);
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::print() const{
-  _print(this->_data,this->_dimensionX,this->_dimensionY);
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::print() const{
+  this->_print(this->_data,this->_dimensionX,this->_dimensionY);
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::print_data() const{
-  _print(this->_data,this->_dimensionX,this->_dimensionY);
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::print_data() const{
+  this->_print(this->_data,this->_dimensionX,this->_dimensionY);
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::print_scratch() const{
-  _print(this->_scratch,this->_dimensionX,this->_dimensionY);
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::print_scratch() const{
+  this->_print(this->_scratch,this->_dimensionX,this->_dimensionY);
 }
 
-template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy>
-void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy>::print_pad() const{
+template<typename ScalarType, typename DimensionType, typename StructurePolicy, typename OffloadPolicy, typename AllocatorPolicy>
+void matrix<ScalarType,DimensionType,StructurePolicy,OffloadPolicy,AllocatorPolicy>::print_pad() const{
   rect::_print(this->_pad,this->_dimensionX,this->_dimensionY);
 }
@@ -69,6 +69,66 @@ public:
                      typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer=0, size_t dest_buffer=0);
 };
 
+// RFP blocks are not contiguous along columns, so the upper triangle of the block is copied element by element.
+//   The specializations below all forward here, whichever side is RFP.
+class serialize_rfp{
+public:
+  template<typename SrcType, typename DestType>
+  static void invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                     typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer, size_t dest_buffer);
+};
+
+// These also serve to unpack an RFP matrix into its dense pad buffer (and to pack it back), e.g. invoke(A,A,...,1,2).
+template<>
+class serialize<rfp,rfp>{
+public:
+  template<typename SrcType, typename DestType>
+  static void invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                     typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer=0, size_t dest_buffer=0);
+};
+
+template<typename Structure>
+class serialize<rfp,Structure>{
+public:
+  template<typename SrcType, typename DestType>
+  static void invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                     typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer=0, size_t dest_buffer=0);
+};
+
+template<typename Structure>
+class serialize<Structure,rfp>{
+public:
+  template<typename SrcType, typename DestType>
+  static void invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                     typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer=0, size_t dest_buffer=0);
+};
+
+// Tiled blocks are copied in column segments that stop at tile boundaries, where the (dense) layout stops being contiguous.
+//   These also serve to unpack a tiled matrix into its dense pad buffer (and to pack it back), e.g. invoke(A,A,...,1,2).
+template<int64_t SrcTileDimension, int64_t DestTileDimension>
+class serialize<tiled<SrcTileDimension>,tiled<DestTileDimension>>{
+public:
+  template<typename SrcType, typename DestType>
+  static void invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                     typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer=0, size_t dest_buffer=0);
+};
+
+template<int64_t TileDimension>
+class serialize<rect,tiled<TileDimension>>{
+public:
+  template<typename SrcType, typename DestType>
+  static void invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                     typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer=0, size_t dest_buffer=0);
+};
+
+template<int64_t TileDimension>
+class serialize<tiled<TileDimension>,rect>{
+public:
+  template<typename SrcType, typename DestType>
+  static void invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                     typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer=0, size_t dest_buffer=0);
+};
+
 #include "serialize.hpp"
 
 #endif /* MATRIX_SERIALIZE_H_ */
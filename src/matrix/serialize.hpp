@@ -148,3 +148,119 @@ CRITTER_START(serialize);
 CRITTER_STOP(serialize);
 #endif
 }
+
+template<typename SrcType, typename DestType>
+void serialize_rfp::invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                           typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer, size_t dest_buffer){
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(serialize);
+#endif
+  using T = typename SrcType::ScalarType; using U = typename SrcType::DimensionType;
+  assert((sex-ssx)==(dex-dsx)); assert((sey-ssy)==(dey-dsy));
+  U rangeX = sex-ssx; U rangeY = sey-ssy;
+  T* s; if (src_buffer==0) s=src.data(); else if (src_buffer==1) s=src.scratch(); else s=src.pad();
+  T* d; if (dest_buffer==0) d=dest.data(); else if (dest_buffer==1) d=dest.scratch(); else d=dest.pad();
+  for (U i=0; i<rangeX; i++){
+    for (U j=0; j<std::min(i+1,rangeY); j++){
+      d[dest.offset_local(dsx+i,dsy+j,dest_buffer)] = s[src.offset_local(ssx+i,ssy+j,src_buffer)];
+    }
+  }
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(serialize);
+#endif
+}
+
+template<typename SrcType, typename DestType>
+void serialize<rfp,rfp>::invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                                 typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer, size_t dest_buffer){
+  serialize_rfp::invoke(src,dest,ssx,sex,ssy,sey,dsx,dex,dsy,dey,src_buffer,dest_buffer);
+}
+
+template<typename Structure>
+template<typename SrcType, typename DestType>
+void serialize<rfp,Structure>::invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                                 typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer, size_t dest_buffer){
+  serialize_rfp::invoke(src,dest,ssx,sex,ssy,sey,dsx,dex,dsy,dey,src_buffer,dest_buffer);
+}
+
+template<typename Structure>
+template<typename SrcType, typename DestType>
+void serialize<Structure,rfp>::invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                                 typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer, size_t dest_buffer){
+  serialize_rfp::invoke(src,dest,ssx,sex,ssy,sey,dsx,dex,dsy,dey,src_buffer,dest_buffer);
+}
+
+template<int64_t SrcTileDimension, int64_t DestTileDimension>
+template<typename SrcType, typename DestType>
+void serialize<tiled<SrcTileDimension>,tiled<DestTileDimension>>::invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                                 typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer, size_t dest_buffer){
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(serialize);
+#endif
+  using T = typename SrcType::ScalarType; using U = typename SrcType::DimensionType;
+  assert((sex-ssx)==(dex-dsx)); assert((sey-ssy)==(dey-dsy));
+  U rangeX = sex-ssx; U rangeY = sey-ssy;
+  T* s; if (src_buffer==0) s=src.data(); else if (src_buffer==1) s=src.scratch(); else s=src.pad();
+  T* d; if (dest_buffer==0) d=dest.data(); else if (dest_buffer==1) d=dest.scratch(); else d=dest.pad();
+  for (U i=0; i<rangeX; i++){
+    for (U j=0; j<rangeY;){
+      U run = std::min<U>((src_buffer==2 ? rangeY-j : std::min<U>(rangeY-j,SrcTileDimension-(ssy+j)%SrcTileDimension)),(dest_buffer==2 ? rangeY-j : DestTileDimension-(dsy+j)%DestTileDimension));
+      U dest_idx = dest.offset_local(dsx+i,dsy+j,dest_buffer); U src_idx = src.offset_local(ssx+i,ssy+j,src_buffer);
+      memcpy(&d[dest_idx],&s[src_idx],run*sizeof(T));
+      j += run;
+    }
+  }
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(serialize);
+#endif
+}
+
+template<int64_t TileDimension>
+template<typename SrcType, typename DestType>
+void serialize<rect,tiled<TileDimension>>::invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                                 typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer, size_t dest_buffer){
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(serialize);
+#endif
+  using T = typename SrcType::ScalarType; using U = typename SrcType::DimensionType;
+  assert((sex-ssx)==(dex-dsx)); assert((sey-ssy)==(dey-dsy));
+  U rangeX = sex-ssx; U rangeY = sey-ssy;
+  T* s; if (src_buffer==0) s=src.data(); else if (src_buffer==1) s=src.scratch(); else s=src.pad();
+  T* d; if (dest_buffer==0) d=dest.data(); else if (dest_buffer==1) d=dest.scratch(); else d=dest.pad();
+  for (U i=0; i<rangeX; i++){
+    for (U j=0; j<rangeY;){
+      U run = std::min<U>(rangeY-j,(dest_buffer==2 ? rangeY-j : TileDimension-(dsy+j)%TileDimension));
+      U dest_idx = dest.offset_local(dsx+i,dsy+j,dest_buffer); U src_idx = src.offset_local(ssx+i,ssy+j,src_buffer);
+      memcpy(&d[dest_idx],&s[src_idx],run*sizeof(T));
+      j += run;
+    }
+  }
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(serialize);
+#endif
+}
+
+template<int64_t TileDimension>
+template<typename SrcType, typename DestType>
+void serialize<tiled<TileDimension>,rect>::invoke(const SrcType& src, DestType& dest, typename SrcType::DimensionType ssx, typename SrcType::DimensionType sex, typename SrcType::DimensionType ssy, typename SrcType::DimensionType sey,
+                                 typename SrcType::DimensionType dsx, typename SrcType::DimensionType dex, typename SrcType::DimensionType dsy, typename SrcType::DimensionType dey, size_t src_buffer, size_t dest_buffer){
+#ifdef FUNCTION_SYMBOLS
+CRITTER_START(serialize);
+#endif
+  using T = typename SrcType::ScalarType; using U = typename SrcType::DimensionType;
+  assert((sex-ssx)==(dex-dsx)); assert((sey-ssy)==(dey-dsy));
+  U rangeX = sex-ssx; U rangeY = sey-ssy;
+  T* s; if (src_buffer==0) s=src.data(); else if (src_buffer==1) s=src.scratch(); else s=src.pad();
+  T* d; if (dest_buffer==0) d=dest.data(); else if (dest_buffer==1) d=dest.scratch(); else d=dest.pad();
+  for (U i=0; i<rangeX; i++){
+    for (U j=0; j<rangeY;){
+      U run = (src_buffer==2 ? rangeY-j : std::min<U>(rangeY-j,TileDimension-(ssy+j)%TileDimension));
+      U dest_idx = dest.offset_local(dsx+i,dsy+j,dest_buffer); U src_idx = src.offset_local(ssx+i,ssy+j,src_buffer);
+      memcpy(&d[dest_idx],&s[src_idx],run*sizeof(T));
+      j += run;
+    }
+  }
+#ifdef FUNCTION_SYMBOLS
+CRITTER_STOP(serialize);
+#endif
+}
@@ -14,11 +14,11 @@ public:
   template<typename ScalarType, typename DimensionType>
   static void _print(const ScalarType* data, DimensionType dimensionX, DimensionType dimensionY);
 protected:
-  template<typename ScalarType, typename DimensionType>
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
   static void _assemble(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType& matrixNumElems, DimensionType dimensionX, DimensionType dimensionY);
-  template<typename ScalarType, typename DimensionType>
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
   static void _assemble_matrix(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType dimensionX, DimensionType dimensionY);
-  template<typename ScalarType, typename DimensionType>
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
   static void _copy(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, ScalarType* const & source, DimensionType dimensionX, DimensionType dimensionY);
   template<typename ScalarType, typename DimensionType>
   void _distribute_identity(ScalarType* data, DimensionType dimensionX, DimensionType dimensionY, DimensionType globalDimensionX, DimensionType globalDimensionY, int64_t localPgridDimX,
@@ -40,11 +40,11 @@ public:
   template<typename ScalarType, typename DimensionType>
   static void _print(const ScalarType* data, DimensionType dimensionX, DimensionType dimensionY);
 protected:
-  template<typename ScalarType, typename DimensionType>
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
   static void _assemble(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType& matrixNumElems, DimensionType dimensionX, DimensionType dimensionY);
-  template<typename ScalarType, typename DimensionType>
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
   static void _assemble_matrix(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType dimensionX, DimensionType dimensionY);
-  template<typename ScalarType, typename DimensionType>
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
   static void _copy(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, ScalarType* const & source, DimensionType dimensionX, DimensionType dimensionY);
   template<typename ScalarType, typename DimensionType>
   static void _distribute_random(ScalarType* data, DimensionType dimensionX, DimensionType dimensionY, DimensionType globalDimensionX, DimensionType globalDimensionY, int64_t localPgridDimX, int64_t localPgridDimY,
@@ -60,17 +60,72 @@ public:
   template<typename ScalarType, typename DimensionType>
   static void _print(const ScalarType* data, DimensionType dimensionX, DimensionType dimensionY);
 protected:
-  template<typename ScalarType, typename DimensionType>
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
   static void _assemble(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType& matrixNumElems, DimensionType dimensionX, DimensionType dimensionY);
-  template<typename ScalarType, typename DimensionType>
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
   static void _assemble_matrix(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType dimensionX, DimensionType dimensionY);
-  template<typename ScalarType, typename DimensionType>
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
   static void _copy(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, ScalarType* const & source, DimensionType dimensionX, DimensionType dimensionY);
   template<typename ScalarType, typename DimensionType>
   static void _distribute_random(ScalarType* data, DimensionType dimensionX, DimensionType dimensionY, DimensionType globalDimensionX, DimensionType globalDimensionY, int64_t localPgridDimX, int64_t localPgridDimY,
                                  int64_t globalPgridDimX, int64_t globalPgridDimY, int64_t key);
 };
 
+// Rectangular Full Packed storage of an upper-triangular n x n matrix (LAPACK's TRANSR='N', UPLO='U' layout): n(n+1)/2 elements in a
+//   ld x (n-n/2) column-major array, with ld = n (n odd) or n+1 (n even). With n1 = n/2, the array holds three dense blocks that Level-3 BLAS consumes directly:
+//     T12 (n1 x (n-n1)) at offset 0, upper-triangular T22 at offset n1, and lower-triangular T11^T at offset n1+1, all with leading dimension ld.
+class rfp{
+public:
+  template<typename DimensionType>
+  static inline DimensionType _num_elems(DimensionType rangeX, DimensionType rangeY) { return ((rangeX*(rangeX+1))>>1); }
+  template<typename DimensionType>
+  static inline DimensionType _offset(DimensionType coordX, DimensionType coordY, DimensionType dimX, DimensionType dimY) {
+    DimensionType n1 = (dimX>>1); return (coordX >= n1 ? (coordX-n1)*_leading_dimension(dimX)+coordY : coordY*_leading_dimension(dimX)+n1+1+coordX); }
+  template<typename DimensionType>
+  static inline DimensionType _leading_dimension(DimensionType dimX) { return (dimX%2 ? dimX : dimX+1); }
+  template<typename ScalarType, typename DimensionType>
+  static void _print(const ScalarType* data, DimensionType dimensionX, DimensionType dimensionY);
+protected:
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
+  static void _assemble(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType& matrixNumElems, DimensionType dimensionX, DimensionType dimensionY);
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
+  static void _assemble_matrix(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType dimensionX, DimensionType dimensionY);
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
+  static void _copy(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, ScalarType* const & source, DimensionType dimensionX, DimensionType dimensionY);
+};
+
+// Tile-major storage of a dense local block: the block is cut into TileDimension x TileDimension tiles (smaller along the last tile row/column),
+//   each tile is stored contiguously in column-major order with leading dimension equal to its own height, and tiles are laid out in column-major order.
+//   No padding is stored, so a dimX x dimY block occupies dimX*dimY elements, the same as rect.
+template<int64_t TileDimension = 64>
+class tiled{
+public:
+  static constexpr int64_t tile_dimension = TileDimension;
+  template<typename DimensionType>
+  static inline DimensionType _num_elems(DimensionType rangeX, DimensionType rangeY) { return rangeX*rangeY; }
+  template<typename DimensionType>
+  static inline DimensionType _offset(DimensionType coordX, DimensionType coordY, DimensionType dimX, DimensionType dimY) {
+    DimensionType tileX = coordX/TileDimension; DimensionType tileY = coordY/TileDimension;
+    return tileX*TileDimension*dimY + tileY*TileDimension*_tile_extent(tileX,dimX) + (coordX%TileDimension)*_tile_extent(tileY,dimY) + coordY%TileDimension; }
+  // Number of rows (columns) in tile row (column) tileIndex of a block with dim rows (columns)
+  template<typename DimensionType>
+  static inline DimensionType _tile_extent(DimensionType tileIndex, DimensionType dim) { return std::min(static_cast<DimensionType>(TileDimension), dim-tileIndex*TileDimension); }
+  template<typename ScalarType, typename DimensionType>
+  static void _print(const ScalarType* data, DimensionType dimensionX, DimensionType dimensionY);
+protected:
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
+  static void _assemble(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType& matrixNumElems, DimensionType dimensionX, DimensionType dimensionY);
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
+  static void _assemble_matrix(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType dimensionX, DimensionType dimensionY);
+  template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
+  static void _copy(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, ScalarType* const & source, DimensionType dimensionX, DimensionType dimensionY);
+};
+
+template<typename Structure>
+struct is_tiled : std::false_type{ static constexpr int64_t tile_dimension = 0; };
+template<int64_t TileDimension>
+struct is_tiled<tiled<TileDimension>> : std::true_type{ static constexpr int64_t tile_dimension = TileDimension; };
+
 #include "structure.hpp"
 
 #endif /* MATRIX_STRUCTURE_H_ */
@@ -1,25 +1,23 @@
 /* Author: Edward Hutter */
 
-template<typename ScalarType, typename DimensionType>
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
 void rect::_assemble(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType& matrixNumElems, DimensionType dimensionX, DimensionType dimensionY){
   matrixNumElems = dimensionX * dimensionY;
-  data = new ScalarType[matrixNumElems];
-  std::memset(data,0,matrixNumElems*sizeof(ScalarType));
-  _assemble_matrix(data, scratch, pad, dimensionX, dimensionY);
+  data = AllocatorPolicy::template _allocate<ScalarType>(matrixNumElems);
+  AllocatorPolicy::_zero(data,matrixNumElems);
+  _assemble_matrix<AllocatorPolicy>(data, scratch, pad, dimensionX, dimensionY);
 }
 
-template<typename ScalarType, typename DimensionType>
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
 void rect::_assemble_matrix(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType dimensionX, DimensionType dimensionY){
-  DimensionType matrixNumElems = dimensionX * dimensionY;
-  scratch = new ScalarType[matrixNumElems];
-  std::memset(scratch,0,matrixNumElems*sizeof(ScalarType));
-  pad = nullptr;
+  // scratch and pad are materialized on first use by the matrix
+  scratch = nullptr; pad = nullptr;
 }
 
-template<typename ScalarType, typename DimensionType>
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
 void rect::_copy(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, ScalarType* const & source, DimensionType dimensionX, DimensionType dimensionY){
   DimensionType numElems = 0;
-  _assemble(data, scratch, pad, numElems, dimensionX, dimensionY);
+  _assemble<AllocatorPolicy>(data, scratch, pad, numElems, dimensionX, dimensionY);
   std::memcpy(&data[0], &source[0], numElems*sizeof(ScalarType));
 }
 
@@ -65,33 +63,27 @@ void rect::_distribute_identity(ScalarType* data, DimensionType dimensionX, Dime
   return;
 }
 
+// Symmetric entries are keyed on (min(row,column),max(row,column)), so every process generates matching values for both halves.
+//   The key is not used, as every process must agree on the matrix.
 template<typename ScalarType, typename DimensionType>
 void rect::_distribute_symmetric(ScalarType* data, DimensionType dimensionX, DimensionType dimensionY, DimensionType globalDimensionX, DimensionType globalDimensionY, int64_t localPgridDimX,
                                  int64_t localPgridDimY, int64_t globalPgridDimX, int64_t globalPgridDimY, int64_t key, bool diagonallyDominant){
 
-  srand48(key);
   int64_t padXlen = (((globalDimensionX % globalPgridDimX != 0) && ((dimensionX-1)*globalPgridDimX + localPgridDimX >= globalDimensionX)) ? dimensionX-1 : dimensionX);
   int64_t padYlen = (((globalDimensionY % globalPgridDimY != 0) && ((dimensionY-1)*globalPgridDimY + localPgridDimY >= globalDimensionY)) ? dimensionY-1 : dimensionY);
-  DimensionType saveGlobalPositionX = localPgridDimX;
-  DimensionType saveGlobalPositionY = localPgridDimY;
+  #pragma omp parallel for schedule(static)
   for (DimensionType i=0; i<padXlen; i++){
-    saveGlobalPositionY = localPgridDimY;
+    uint64_t globalPositionX = localPgridDimX + i*globalPgridDimX;
+    #pragma omp simd
     for (DimensionType j=0; j<padYlen; j++){
-      if (saveGlobalPositionX > saveGlobalPositionY){
-        srand48(saveGlobalPositionX + globalDimensionY*saveGlobalPositionY);
-      }
-      else{
-        srand48(saveGlobalPositionY + globalDimensionY*saveGlobalPositionX);
-      }
-      data[i*dimensionY+j] = drand48();			// Change this later.
-      if ((diagonallyDominant) && (saveGlobalPositionX == saveGlobalPositionY) && (i==j)){
-        data[i*dimensionY+j] += globalDimensionX;		// X or Y, should not matter
-      }
-      saveGlobalPositionY += globalPgridDimY;
+      uint64_t globalPositionY = localPgridDimY + j*globalPgridDimY;
+      data[i*dimensionY+j] = philox::uniform(0, std::min(globalPositionX,globalPositionY), std::max(globalPositionX,globalPositionY));
+    }
+    if ((diagonallyDominant) && (i<padYlen) && (globalPositionX == static_cast<uint64_t>(localPgridDimY + i*globalPgridDimY))){
+      data[i*dimensionY+i] += globalDimensionX;		// X or Y, should not matter
     }
     // check for padding
     if (padYlen != dimensionY) { data[i*dimensionY+dimensionY-1] = 0; }
-    saveGlobalPositionX += globalPgridDimX;
   }
   // check for padding
   if (padXlen != dimensionX){
@@ -105,19 +97,17 @@ void rect::_distribute_symmetric(ScalarType* data, DimensionType dimensionX, Dim
 template<typename ScalarType, typename DimensionType>
 void rect::_distribute_random(ScalarType* data, DimensionType dimensionX, DimensionType dimensionY, DimensionType globalDimensionX, DimensionType globalDimensionY, int64_t localPgridDimX,
                               int64_t localPgridDimY, int64_t globalPgridDimX, int64_t globalPgridDimY, int64_t key){
-  srand48(key);
-  DimensionType saveGlobalPosition = localPgridDimY + localPgridDimX*globalDimensionY;		// Watch for 64-bit problems later with temporaries being implicitely casted.
   int64_t padXlen = (((globalDimensionX % globalPgridDimX != 0) && ((dimensionX-1)*globalPgridDimX + localPgridDimX >= globalDimensionX)) ? dimensionX-1 : dimensionX);
   int64_t padYlen = (((globalDimensionY % globalPgridDimY != 0) && ((dimensionY-1)*globalPgridDimY + localPgridDimY >= globalDimensionY)) ? dimensionY-1 : dimensionY);
+  #pragma omp parallel for schedule(static)
   for (DimensionType i=0; i<padXlen; i++){
-    DimensionType globalPosition = saveGlobalPosition;
+    uint64_t globalPositionX = localPgridDimX + i*globalPgridDimX;
+    #pragma omp simd
     for (DimensionType j=0; j<padYlen; j++){
-      data[i*dimensionY+j] = drand48();			// Change this later.
-      globalPosition += globalPgridDimY;
+      data[i*dimensionY+j] = philox::uniform(key, localPgridDimY + j*globalPgridDimY, globalPositionX);
     }
     // check for padding
     if (padYlen != dimensionY) { data[i*dimensionY+dimensionY-1] = 0; }
-    saveGlobalPosition += (globalPgridDimX*globalDimensionY);
   }
   // check for padding
   if (padXlen != dimensionX){
@@ -129,28 +119,24 @@ void rect::_distribute_random(ScalarType* data, DimensionType dimensionX, Dimens
 }
 
 
-template<typename ScalarType, typename DimensionType>
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
 void uppertri::_assemble(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType& matrixNumElems, DimensionType dimensionX, DimensionType dimensionY){
   matrixNumElems = ((dimensionY*(dimensionY+1))>>1);		// dimensionX == dimensionY
-  data = new ScalarType[matrixNumElems];
-  std::memset(data,0,matrixNumElems*sizeof(ScalarType));
-  _assemble_matrix(data, scratch, pad, dimensionX, dimensionY);
+  data = AllocatorPolicy::template _allocate<ScalarType>(matrixNumElems);
+  AllocatorPolicy::_zero(data,matrixNumElems);
+  _assemble_matrix<AllocatorPolicy>(data, scratch, pad, dimensionX, dimensionY);
 }
 
-template<typename ScalarType, typename DimensionType>
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
 void uppertri::_assemble_matrix(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType dimensionX, DimensionType dimensionY){
-  DimensionType nonPackedNumElems = dimensionX*dimensionY;
-  DimensionType matrixNumElems = ((dimensionY*(dimensionY+1))>>1);		// dimensionX == dimensionY
-  scratch = new ScalarType[matrixNumElems];
-  std::memset(scratch,0,matrixNumElems*sizeof(ScalarType));
-  pad = new ScalarType[nonPackedNumElems];
-  std::memset(pad,0,matrixNumElems*sizeof(ScalarType));
+  // scratch and pad are materialized on first use by the matrix
+  scratch = nullptr; pad = nullptr;
 }
 
-template<typename ScalarType, typename DimensionType>
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
 void uppertri::_copy(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, ScalarType* const & source, DimensionType dimensionX, DimensionType dimensionY){
   DimensionType numElems = 0;
-  _assemble(data, scratch, pad, numElems, dimensionX, dimensionY);
+  _assemble<AllocatorPolicy>(data, scratch, pad, numElems, dimensionX, dimensionY);
   std::memcpy(&data[0], &source[0], numElems*sizeof(ScalarType));
 }
 
@@ -207,29 +193,25 @@ void uppertri::_distribute_random(ScalarType* data, DimensionType dimensionX, Di
 }
 */
 
-template<typename ScalarType, typename DimensionType>
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
 void lowertri::_assemble(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType& matrixNumElems, DimensionType dimensionX, DimensionType dimensionY){
   matrixNumElems = ((dimensionY*(dimensionY+1))>>1);
-  data = new ScalarType[matrixNumElems];
-  std::memset(data,0,matrixNumElems*sizeof(ScalarType));
-  _assemble_matrix(data, scratch, pad, dimensionX, dimensionY);
+  data = AllocatorPolicy::template _allocate<ScalarType>(matrixNumElems);
+  AllocatorPolicy::_zero(data,matrixNumElems);
+  _assemble_matrix<AllocatorPolicy>(data, scratch, pad, dimensionX, dimensionY);
 }
 
-template<typename ScalarType, typename DimensionType>
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
 void lowertri::_assemble_matrix(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType dimensionX, DimensionType dimensionY){
-  DimensionType nonPackedNumElems = dimensionX*dimensionY;
-  DimensionType matrixNumElems = ((dimensionY*(dimensionY+1))>>1);		// dimensionX == dimensionY
-  scratch = new ScalarType[matrixNumElems];
-  std::memset(scratch,0,matrixNumElems*sizeof(ScalarType));
-  pad = new ScalarType[nonPackedNumElems];
-  std::memset(pad,0,matrixNumElems*sizeof(ScalarType));
+  // scratch and pad are materialized on first use by the matrix
+  scratch = nullptr; pad = nullptr;
 }
 
 /*
-template<typename ScalarType, typename DimensionType>
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
 void lowertri::_copy(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, ScalarType* const & source, DimensionType dimensionX, DimensionType dimensionY){
   DimensionType numElems = 0;
-  _assemble(data, scratch, pad, numElems, dimensionX, dimensionY);
+  _assemble<AllocatorPolicy>(data, scratch, pad, numElems, dimensionX, dimensionY);
   std::memcpy(&data[0], &source[0], numElems*sizeof(T));
 }
 */
@@ -247,7 +229,6 @@ void lowertri::_print(const ScalarType* data, DimensionType dimensionX, Dimensio
 template<typename ScalarType, typename DimensionType>
 void lowertri::_distribute_random(ScalarType* data, DimensionType dimensionX, DimensionType dimensionY, DimensionType globalDimensionX, DimensionType globalDimensionY, int64_t localPgridDimX, int64_t localPgridDimY,
                                   int64_t globalPgridDimX, int64_t globalPgridDimY, int64_t key){
-  srand48(key);
   int64_t padXlen = (((globalDimensionX % globalPgridDimX != 0) && ((dimensionX-1)*globalPgridDimX + localPgridDimX >= globalDimensionX)) ? dimensionX-1 : dimensionX);
   int64_t padYlen = (((globalDimensionY % globalPgridDimY != 0) && ((dimensionY-1)*globalPgridDimY + localPgridDimY >= globalDimensionY)) ? dimensionY-1 : dimensionY);
   DimensionType saveGlobalPosX = localPgridDimX;
@@ -264,7 +245,6 @@ void lowertri::_distribute_random(ScalarType* data, DimensionType dimensionX, Di
       saveGlobalPosY += globalPgridDimY;
     }
     for (DimensionType j=counter; j<padYlen; j++){
-      srand48(saveGlobalPosX + globalDimensionY*saveGlobalPosY);
       // Maybe in the future, get rid of this inner if statementand try something else? If statements in inner
       //   nested loops can be very expensive.
       if (saveGlobalPosX == saveGlobalPosY){
@@ -272,7 +252,7 @@ void lowertri::_distribute_random(ScalarType* data, DimensionType dimensionX, Di
         data[_offset(i,j,dimensionX,dimensionY)] = 1.;
       }
       else{
-        data[_offset(i,j,dimensionX,dimensionY)] = drand48();
+        data[_offset(i,j,dimensionX,dimensionY)] = philox::uniform(key, saveGlobalPosY, saveGlobalPosX);
       }
       // check padding
       if (padXlen != dimensionX) { data[_offset(i,dimensionY-i,dimensionX,dimensionY)] = 0; }
@@ -285,3 +265,72 @@ void lowertri::_distribute_random(ScalarType* data, DimensionType dimensionX, Di
   }
   return;
 }
+
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
+void rfp::_assemble(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType& matrixNumElems, DimensionType dimensionX, DimensionType dimensionY){
+  matrixNumElems = ((dimensionY*(dimensionY+1))>>1);		// dimensionX == dimensionY
+  data = AllocatorPolicy::template _allocate<ScalarType>(matrixNumElems);
+  AllocatorPolicy::_zero(data,matrixNumElems);
+  _assemble_matrix<AllocatorPolicy>(data, scratch, pad, dimensionX, dimensionY);
+}
+
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
+void rfp::_assemble_matrix(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType dimensionX, DimensionType dimensionY){
+  // scratch and pad are materialized on first use by the matrix
+  scratch = nullptr; pad = nullptr;
+}
+
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
+void rfp::_copy(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, ScalarType* const & source, DimensionType dimensionX, DimensionType dimensionY){
+  DimensionType numElems = 0;
+  _assemble<AllocatorPolicy>(data, scratch, pad, numElems, dimensionX, dimensionY);
+  std::memcpy(&data[0], &source[0], numElems*sizeof(ScalarType));
+}
+
+template<typename ScalarType, typename DimensionType>
+void rfp::_print(const ScalarType* data, DimensionType dimensionX, DimensionType dimensionY){
+  for (DimensionType i=0; i<dimensionY; i++){
+    for (DimensionType j=0; j<i; j++){
+      std::cout << "    ";
+    }
+    for (DimensionType j=i; j<dimensionX; j++){
+      std::cout << " " << data[_offset(j,i,dimensionX,dimensionY)];
+    }
+    std::cout << std::endl;
+  }
+}
+
+template<int64_t TileDimension>
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
+void tiled<TileDimension>::_assemble(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType& matrixNumElems, DimensionType dimensionX, DimensionType dimensionY){
+  matrixNumElems = dimensionX * dimensionY;
+  data = AllocatorPolicy::template _allocate<ScalarType>(matrixNumElems);
+  AllocatorPolicy::_zero(data,matrixNumElems);
+  _assemble_matrix<AllocatorPolicy>(data, scratch, pad, dimensionX, dimensionY);
+}
+
+template<int64_t TileDimension>
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
+void tiled<TileDimension>::_assemble_matrix(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, DimensionType dimensionX, DimensionType dimensionY){
+  // scratch and pad are materialized on first use by the matrix
+  scratch = nullptr; pad = nullptr;
+}
+
+template<int64_t TileDimension>
+template<typename AllocatorPolicy, typename ScalarType, typename DimensionType>
+void tiled<TileDimension>::_copy(ScalarType*& data, ScalarType*& scratch, ScalarType*& pad, ScalarType* const & source, DimensionType dimensionX, DimensionType dimensionY){
+  DimensionType numElems = 0;
+  _assemble<AllocatorPolicy>(data, scratch, pad, numElems, dimensionX, dimensionY);
+  std::memcpy(&data[0], &source[0], numElems*sizeof(ScalarType));
+}
+
+template<int64_t TileDimension>
+template<typename ScalarType, typename DimensionType>
+void tiled<TileDimension>::_print(const ScalarType* data, DimensionType dimensionX, DimensionType dimensionY){
+  for (DimensionType i=0; i<dimensionY; i++){
+    for (DimensionType j=0; j<dimensionX; j++){
+      std::cout << " " << data[_offset(j,i,dimensionX,dimensionY)];
+    }
+    std::cout << std::endl;
+  }
+}
@@ -0,0 +1,64 @@
+/* Author: Edward Hutter */
+
+#ifndef MATRIX_VIEW_H_
+#define MATRIX_VIEW_H_
+
+// A strided window onto a block of a rect-structured matrix's local data.
+//   data() addresses the parent's storage with the parent's leading dimension, so algorithms can update sub-blocks in place.
+//   scratch() is contiguous, and is either borrowed from the caller (e.g. an existing intermediate buffer) or allocated on first use.
+template<typename ScalarT = double, typename DimensionT = int64_t>
+class matrix_view{
+public:
+  using ScalarType = ScalarT;
+  using DimensionType = DimensionT;
+  using StructureType = rect;
+
+  template<typename MatrixType>
+  explicit matrix_view(MatrixType& parent, DimensionType startX, DimensionType endX, DimensionType startY, DimensionType endY, ScalarType* scratch=nullptr);
+  matrix_view(const matrix_view& rhs) = delete;
+  matrix_view(matrix_view&& rhs);
+  matrix_view& operator=(const matrix_view& rhs) = delete;
+  matrix_view& operator=(matrix_view&& rhs) = delete;
+  ~matrix_view();
+  // Special methods used by summa
+  void _stage_();
+  void _writeback_(ScalarType beta);
+
+  inline ScalarType*& data() { return this->_data; }
+  inline ScalarType* data() const { return this->_data; }
+  inline ScalarType*& scratch() { if (this->_scratch == nullptr){ _materialize(); } return this->_scratch; }
+  inline ScalarType* scratch() const { return const_cast<matrix_view*>(this)->scratch(); }
+  inline ScalarType* pad() const { return nullptr; }		// Views are rect, and so never need a pad buffer
+  inline DimensionType num_elems() const { return this->_dimensionX*this->_dimensionY; }
+  inline DimensionType num_elems(DimensionType rangeX, DimensionType rangeY) const { return rangeX*rangeY; }
+  inline DimensionType num_rows_local() const { return this->_dimensionY; }
+  inline DimensionType num_columns_local() const { return this->_dimensionX; }
+  inline DimensionType leading_dimension(size_t buffer=0) const { return buffer==0 ? this->_data_ld : this->_scratch_ld; }
+  inline DimensionType offset_local(DimensionType coordX, DimensionType coordY, size_t buffer=0) const { return coordX*leading_dimension(buffer)+coordY; }
+
+  inline void swap() { ScalarType* ptr = this->data(); this->data() = this->scratch(); this->scratch() = ptr; std::swap(this->_data_ld,this->_scratch_ld); }
+  inline void swap_pad() {}
+
+private:
+  void _materialize();
+
+  ScalarType* _data;				// Either the parent's storage or the contiguous buffer, depending on how many times swap() was called
+  ScalarType* _scratch;
+  ScalarType* _parent;				// Address of the block's first element in the parent's storage
+  ScalarType* _buffer;				// Contiguous buffer of _dimensionX*_dimensionY elements
+  bool _owns_buffer;
+  DimensionType _data_ld;
+  DimensionType _scratch_ld;
+  DimensionType _parent_ld;
+  DimensionType _dimensionX;			// Number of columns in the block
+  DimensionType _dimensionY;			// Number of rows in the block
+};
+
+template<typename MatrixType>
+struct is_matrix_view : std::false_type{};
+template<typename ScalarType, typename DimensionType>
+struct is_matrix_view<matrix_view<ScalarType,DimensionType>> : std::true_type{};
+
+#include "view.hpp"
+
+#endif /* MATRIX_VIEW_H_ */
@@ -0,0 +1,54 @@
+/* Author: Edward Hutter */
+
+template<typename ScalarType, typename DimensionType>
+template<typename MatrixType>
+matrix_view<ScalarType,DimensionType>::matrix_view(MatrixType& parent, DimensionType startX, DimensionType endX, DimensionType startY, DimensionType endY, ScalarType* scratch){
+  static_assert(std::is_same<typename MatrixType::StructureType,rect>::value,"views require a dense column-major parent");
+  this->_parent_ld = parent.leading_dimension(0);
+  this->_parent = parent.data() + parent.offset_local(startX,startY);
+  this->_dimensionX = endX-startX; this->_dimensionY = endY-startY;
+  this->_buffer = scratch; this->_owns_buffer = false;
+  this->_data = this->_parent; this->_data_ld = this->_parent_ld;
+  this->_scratch = this->_buffer; this->_scratch_ld = this->_dimensionY;
+}
+
+template<typename ScalarType, typename DimensionType>
+matrix_view<ScalarType,DimensionType>::matrix_view(matrix_view&& rhs){
+  this->_data = rhs._data; this->_scratch = rhs._scratch; this->_parent = rhs._parent; this->_buffer = rhs._buffer; this->_owns_buffer = rhs._owns_buffer;
+  this->_data_ld = rhs._data_ld; this->_scratch_ld = rhs._scratch_ld; this->_parent_ld = rhs._parent_ld;
+  this->_dimensionX = rhs._dimensionX; this->_dimensionY = rhs._dimensionY;
+  rhs._buffer = nullptr; rhs._owns_buffer = false;
+}
+
+template<typename ScalarType, typename DimensionType>
+matrix_view<ScalarType,DimensionType>::~matrix_view(){
+  if (this->_owns_buffer && (this->_buffer != nullptr)){ HeapAllocator::_deallocate(this->_buffer); }
+}
+
+template<typename ScalarType, typename DimensionType>
+void matrix_view<ScalarType,DimensionType>::_materialize(){
+  this->_buffer = HeapAllocator::template _allocate<ScalarType>(this->_dimensionX*this->_dimensionY); this->_owns_buffer = true;
+  this->_scratch = this->_buffer; this->_scratch_ld = this->_dimensionY;
+}
+
+// If a swap left the parent's storage in scratch (e.g. on a broadcast root), move its contents into the contiguous buffer and swap back,
+//   so that collectives over scratch see the same contiguous layout on every process
+template<typename ScalarType, typename DimensionType>
+void matrix_view<ScalarType,DimensionType>::_stage_(){
+  if (this->_scratch != this->_parent) return;
+  this->swap();
+  for (DimensionType i=0; i<this->_dimensionX; i++){
+    std::memcpy(&this->_scratch[i*this->_dimensionY], &this->_parent[i*this->_parent_ld], this->_dimensionY*sizeof(ScalarType));
+  }
+}
+
+// data <- beta*data + scratch, through the parent's leading dimension
+template<typename ScalarType, typename DimensionType>
+void matrix_view<ScalarType,DimensionType>::_writeback_(ScalarType beta){
+  assert(this->_data == this->_parent);
+  for (DimensionType i=0; i<this->_dimensionX; i++){
+    ScalarType* dest = &this->_parent[i*this->_parent_ld]; ScalarType* src = &this->scratch()[i*this->_dimensionY];
+    if (beta == ScalarType(0)){ std::memcpy(dest, src, this->_dimensionY*sizeof(ScalarType)); }
+    else { for (DimensionType j=0; j<this->_dimensionY; j++){ dest[j] = beta*dest[j] + src[j]; } }
+  }
+}
@@ -0,0 +1,32 @@
+/* Author: Edward Hutter */
+
+#ifndef UTIL__RANDOM_H_
+#define UTIL__RANDOM_H_
+
+// Counter-based random number generation (Philox4x32-10, Salmon et al., SC'11).
+//   Each value is a pure function of (seed, row, column), so any process or thread can generate any matrix element
+//   independently and reproducibly, without sharing or replaying generator state.
+class philox{
+public:
+  // Uniform double in [0,1) for global element (row,column) of the stream identified by seed
+  static inline double uniform(uint64_t seed, uint64_t row, uint64_t column){
+    uint32_t ctr0 = static_cast<uint32_t>(row), ctr1 = static_cast<uint32_t>(row>>32), ctr2 = static_cast<uint32_t>(column), ctr3 = static_cast<uint32_t>(column>>32);
+    uint32_t key0 = static_cast<uint32_t>(seed), key1 = static_cast<uint32_t>(seed>>32);
+    for (int round=0; round<10; round++){
+      uint64_t prod0 = static_cast<uint64_t>(_multiplier0)*ctr0; uint64_t prod1 = static_cast<uint64_t>(_multiplier1)*ctr2;
+      uint32_t next0 = static_cast<uint32_t>(prod1>>32)^ctr1^key0; uint32_t next2 = static_cast<uint32_t>(prod0>>32)^ctr3^key1;
+      ctr1 = static_cast<uint32_t>(prod1); ctr3 = static_cast<uint32_t>(prod0); ctr0 = next0; ctr2 = next2;
+      key0 += _weyl0; key1 += _weyl1;
+    }
+    // 53 random bits from the first two outputs
+    return ((ctr0>>5)*67108864.+(ctr1>>6))*(1./9007199254740992.);
+  }
+
+private:
+  static constexpr uint32_t _multiplier0 = 0xD2511F53;
+  static constexpr uint32_t _multiplier1 = 0xCD9E8D57;
+  static constexpr uint32_t _weyl0 = 0x9E3779B9;
+  static constexpr uint32_t _weyl1 = 0xBB67AE85;
+};
+
+#endif /* UTIL__RANDOM_H_ */
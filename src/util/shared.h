@@ -8,16 +8,25 @@
 #include <iostream>
 #include <cstring>
 #include <cstdlib>
+#include <cstdint>
 #include <stdio.h>
 #include <complex>
 #include <vector>
+#include <deque>
 #include <map>
+#include <unordered_map>
+#include <functional>
 #include <algorithm>
 #include <utility>
 #include <tuple>
+#include <array>
+#include <memory>
 #include <cmath>
 #include <string>
 #include <assert.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #include <complex>
 
 #include <mpi.h>
@@ -35,18 +44,32 @@
 #endif
 
 template<typename ScalarType>
-class mpi_type;
+MPI_Datatype mpi_datatype();
+template<> inline MPI_Datatype mpi_datatype<float>(){ return MPI_FLOAT; }
+template<> inline MPI_Datatype mpi_datatype<double>(){ return MPI_DOUBLE; }
+template<> inline MPI_Datatype mpi_datatype<std::complex<float>>(){ return MPI_CXX_FLOAT_COMPLEX; }
+template<> inline MPI_Datatype mpi_datatype<std::complex<double>>(){ return MPI_CXX_DOUBLE_COMPLEX; }
 
-template<>
-class mpi_type<float>{
-public:
-  constexpr static size_t type = MPI_FLOAT;
-};
-template<>
-class mpi_type<double>{
+// Datatype handles are not compile-time constants under every MPI (OpenMPI's are addresses), so type is initialized once at load time
+template<typename ScalarType>
+class mpi_type{
 public:
-  constexpr static size_t type = MPI_DOUBLE;
+  static const MPI_Datatype type;
 };
+template<typename ScalarType>
+const MPI_Datatype mpi_type<ScalarType>::type = mpi_datatype<ScalarType>();
+
+// For complex scalars, the engines read Transpose::Trans as the conjugate transpose (and syrk as herk, potrf as Hermitian), so the algorithms carry over unchanged
+template<typename ScalarType>
+struct is_complex : std::false_type{};
+template<typename ScalarType>
+struct is_complex<std::complex<ScalarType>> : std::true_type{};
+
+// The type of a scalar's (real and imaginary) components
+template<typename ScalarType>
+struct real_type{ using type = ScalarType; };
+template<typename ScalarType>
+struct real_type<std::complex<ScalarType>>{ using type = ScalarType; };
 
 
 #endif /*SHARED*/
@@ -15,10 +15,11 @@ namespace topo{
 
 class rect{
 public:
-  rect(MPI_Comm comm, size_t c, size_t layout = 0, size_t num_chunks=0){
+  rect(MPI_Comm comm, size_t c, size_t layout = 0, size_t num_chunks=0, size_t pipeline_depth=0){
 
     this->layout = layout;
     this->num_chunks = num_chunks;
+    this->pipeline_depth = pipeline_depth;
     MPI_Comm column;
     int columnRank, cubeRank;
     MPI_Comm_rank(comm, &this->rank);
@@ -61,15 +62,16 @@ public:
 
   MPI_Comm world,row,column_contig,column_alt,depth,slice,cube;
   int rank,size;
-  size_t c,d,x,y,z,layout,num_chunks;
+  size_t c,d,x,y,z,layout,num_chunks,pipeline_depth;	// pipeline_depth>0 pipelines summa's gemm over num_chunks panels of K (see summa::pipeline)
 };
 
 class square{
 public:
-  square(MPI_Comm comm, size_t c, size_t layout=0, size_t num_chunks=0){
+  square(MPI_Comm comm, size_t c, size_t layout=0, size_t num_chunks=0, size_t pipeline_depth=0){
 
     this->layout = layout;
     this->num_chunks = num_chunks;
+    this->pipeline_depth = pipeline_depth;
     MPI_Comm_rank(comm, &this->rank);
     MPI_Comm_size(comm, &this->size);
 
@@ -139,7 +141,63 @@ public:
 
   MPI_Comm world,row,column,slice,depth;
   int rank,size;
-  size_t c,d,x,y,z,layout,num_chunks;
+  size_t c,d,x,y,z,layout,num_chunks,pipeline_depth;	// pipeline_depth>0 pipelines summa's gemm over num_chunks panels of K (see summa::pipeline)
+};
+
+// A pm x pn x pk grid for a gemm whose operands are not square. Its faces are fitted to the M x N x K iteration space (see fit),
+//   so that the blocks of A (M x K), B (K x N) and C (M x N) each process touches are as small as the process count allows.
+//   Coordinates: y along M, x along N, z along K. Depth is innermost in the rank order, as in square's layout 0.
+class cuboid{
+public:
+  cuboid(MPI_Comm comm, size_t pm, size_t pn, size_t pk){
+
+    MPI_Comm_rank(comm, &this->rank);
+    MPI_Comm_size(comm, &this->size);
+    assert(pm*pn*pk == this->size);
+    this->pm = pm; this->pn = pn; this->pk = pk;
+    this->z = this->rank%pk;
+    this->x = (this->rank/pk)%pn;
+    this->y = this->rank/(pk*pn);
+    MPI_Comm_split(comm, this->rank/pk, this->rank, &this->depth);
+    MPI_Comm_split(comm, this->z, this->rank, &this->slice);
+    MPI_Comm_split(this->slice, this->y, this->x, &this->row);
+    MPI_Comm_split(this->slice, this->x, this->y, &this->column);
+
+    if (comm != MPI_COMM_WORLD){
+      MPI_Comm_dup(comm,&this->world);
+    }
+    else{
+      this->world=comm;
+    }
+  }
+  ~cuboid(){
+    MPI_Comm_free(&this->row);
+    MPI_Comm_free(&this->column);
+    MPI_Comm_free(&this->slice);
+    MPI_Comm_free(&this->depth);
+  }
+
+  // The {pm,pn,pk} factorization of size that minimizes the words each process sends in summa's cuboid gemm:
+  //   its share of A gathered along x, of B gathered along y, and of C reduced along z.
+  //   Only grids that divide the operands evenly (M by pm, N by pn, K by pk*pn and by pk*pm) are considered, if there are any.
+  static std::vector<size_t> fit(int64_t M, int64_t N, int64_t K, size_t size){
+    std::vector<size_t> best = {1,1,size}; double bestCost = -1; bool bestEven = false;
+    for (size_t pm=1; pm<=size; pm++){
+      if (size%pm != 0) continue;
+      for (size_t pn=1; pn<=size/pm; pn++){
+        if ((size/pm)%pn != 0) continue;
+        size_t pk = size/(pm*pn);
+        bool even = (M%pm==0) && (N%pn==0) && (K%(pk*pn)==0) && (K%(pk*pm)==0);
+        double cost = (1.*M*K/(pm*pk))*(1.-1./pn) + (1.*K*N/(pk*pn))*(1.-1./pm) + 2.*(1.*M*N/(pm*pn))*(1.-1./pk);
+        if ((even && !bestEven) || ((even == bestEven) && (bestCost < 0 || cost < bestCost))){ best = {pm,pn,pk}; bestCost = cost; bestEven = even; }
+      }
+    }
+    return best;
+  }
+
+  MPI_Comm world,row,column,slice,depth;
+  int rank,size;
+  size_t pm,pn,pk,x,y,z;
 };
 }
 
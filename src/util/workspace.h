@@ -0,0 +1,67 @@
+/* Author: Edward Hutter */
+
+#ifndef WORKSPACE_H_
+#define WORKSPACE_H_
+
+/*
+  Note: workspace replaces the std::maps that algorithms kept their intermediates in. Entries are registered while an algorithm
+        simulates its recursion, and are densely indexed in the order they were registered, so execution reaches them by index
+        (or by a pointer, which stays valid as the workspace grows) rather than by a tree lookup that could insert on a miss.
+        The keys are hashed, so that the registration and any keyed lookup left (e.g. find, at) take constant time.
+        Once sealed, a workspace may not grow; registering a new key is caught by an assert, so debug builds flag any allocation left on the execution path.
+*/
+
+// std::hash, extended to the pairs of dimensions the algorithms key their intermediates by
+template<typename KeyType>
+struct workspace_hash : std::hash<KeyType> {};
+
+template<typename FirstType, typename SecondType>
+struct workspace_hash<std::pair<FirstType,SecondType>>{
+  size_t operator()(const std::pair<FirstType,SecondType>& key) const {
+    size_t seed = workspace_hash<FirstType>()(key.first);
+    return seed ^ (workspace_hash<SecondType>()(key.second) + 0x9e3779b9 + (seed<<6) + (seed>>2));
+  }
+};
+
+template<typename KeyType, typename ValueType>
+class workspace{
+public:
+  using key_type = KeyType;
+  using mapped_type = ValueType;
+
+  // Index of key's entry, or size() if it has none
+  size_t find(const KeyType& key) const { auto it = keys.find(key); return (it == keys.end() ? entries.size() : it->second); }
+  bool contains(const KeyType& key) const { return keys.count(key) != 0; }
+  size_t size() const { return entries.size(); }
+
+  // Constructs key's entry from values, unless key already has one, and returns its index
+  template<typename... ValueTypes>
+  size_t emplace(const KeyType& key, ValueTypes&&... values){
+    auto index = find(key);
+    if (index == entries.size()){
+      assert(!sealed);	// a new entry during execution: the algorithm's simulation missed a buffer
+      keys.emplace(key,index); entries.emplace_back(std::forward<ValueTypes>(values)...);
+    }
+    return index;
+  }
+
+  ValueType& operator[](size_t index){ assert(index < entries.size()); return entries[index]; }
+  const ValueType& operator[](size_t index) const { assert(index < entries.size()); return entries[index]; }
+
+  // Entry of a registered key (never inserts). A miss reads no entry, in release builds too: it aborts.
+  ValueType& at(const KeyType& key){
+    auto index = find(key);
+    if (index == entries.size()){ std::fprintf(stderr, "workspace::at: no entry registered for the key\n"); std::abort(); }
+    return entries[index];
+  }
+
+  void seal(bool sealed = true){ this->sealed = sealed; }
+  void clear(){ keys.clear(); entries.clear(); sealed = false; }
+
+private:
+  std::unordered_map<KeyType,size_t,workspace_hash<KeyType>> keys;	// each key's index into entries
+  std::deque<ValueType> entries;	// a deque never relocates its elements, which need not be movable (e.g. unfilled matrices)
+  bool sealed = false;
+};
+
+#endif /* WORKSPACE_H_ */
@@ -0,0 +1,111 @@
+/* Author: Edward Hutter */
+
+#include "../../src/alg/cholesky/cholinv/cholinv.h"
+#include "validate.h"
+
+using namespace std;
+
+// Factors a diagonally dominant matrix twice (the second factorization replays the plan) and checks the residual on rank 0.
+template<typename AlgType>
+bool check(const char* name, int64_t num_rows, int64_t bcMultiplier, bool complete_inv, size_t rep_factor){
+  using T = double; using U = int64_t;
+  int rank; MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  auto SquareTopo = topo::square(MPI_COMM_WORLD,rep_factor,0,0);
+  matrix<T,U,rect> A(num_rows,num_rows,SquareTopo.d,SquareTopo.d);
+  A.distribute_symmetric(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c, true);
+  typename AlgType::template info<T,U> pack(complete_inv,1,bcMultiplier,'U');
+  AlgType::factor(A, pack, SquareTopo); AlgType::factor(A, pack, SquareTopo);
+  T residual_local = cholesky::validate<AlgType>::residual(A, pack, SquareTopo), residual;
+  MPI_Allreduce(&residual_local, &residual, 1, mpi_type<T>::type, MPI_MAX, MPI_COMM_WORLD);
+  bool pass = (std::abs(residual) < 1e-10);
+  if (rank==0) printf("%-28s N=%ld bc=%ld inv=%d residual %.3e %s\n", name, num_rows, bcMultiplier, static_cast<int>(complete_inv), std::abs(residual), pass ? "PASS" : "FAIL");
+  return pass;
+}
+
+// Factors on one grid and again on a second grid over the same processes, and checks that the second factorization reuses the plan.
+template<typename AlgType>
+bool check_congruent(const char* name, int64_t num_rows, size_t rep_factor){
+  using T = double; using U = int64_t;
+  int rank; MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  auto SquareTopo = topo::square(MPI_COMM_WORLD,rep_factor,0,0);
+  matrix<T,U,rect> A(num_rows,num_rows,SquareTopo.d,SquareTopo.d);
+  A.distribute_symmetric(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c, true);
+  typename AlgType::template info<T,U> pack(true,1,0,'U');
+  AlgType::factor(A, pack, SquareTopo);
+  auto RebuiltTopo = topo::square(MPI_COMM_WORLD,rep_factor,0,0);
+  bool reused = pack.planned(A.num_rows_global(), RebuiltTopo.d, RebuiltTopo.c, RebuiltTopo.slice);
+  AlgType::factor(A, pack, RebuiltTopo);
+  T residual = std::abs(cholesky::validate<AlgType>::residual(A, pack, RebuiltTopo));
+  MPI_Allreduce(MPI_IN_PLACE, &residual, 1, mpi_type<T>::type, MPI_MAX, MPI_COMM_WORLD);
+  bool pass = reused && (residual < 1e-10);
+  if (rank==0) printf("%-28s N=%ld reused %d residual %.3e %s\n", name, num_rows, static_cast<int>(reused), residual, pass ? "PASS" : "FAIL");
+  return pass;
+}
+
+// Factors the same (real) matrix in ScalarType and in double, and checks that the two factors agree to ScalarType's precision.
+template<typename AlgType, typename ScalarType>
+bool check_scalar(const char* name, int64_t num_rows, double tolerance, size_t rep_factor){
+  using U = int64_t;
+  int rank; MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  auto SquareTopo = topo::square(MPI_COMM_WORLD,rep_factor,0,0);
+  matrix<double,U,rect> A(num_rows,num_rows,SquareTopo.d,SquareTopo.d);
+  A.distribute_symmetric(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c, true);
+  matrix<ScalarType,U,rect> B(num_rows,num_rows,SquareTopo.d,SquareTopo.d);
+  for (U i=0; i<A.num_elems(); i++){ B.data()[i] = ScalarType(A.data()[i]); }
+  typename AlgType::template info<double,U> packA(true,1,0,'U'); typename AlgType::template info<ScalarType,U> packB(true,1,0,'U');
+  AlgType::factor(A, packA, SquareTopo); AlgType::factor(B, packB, SquareTopo);
+  auto RA = AlgType::construct_R(packA, SquareTopo); auto RB = AlgType::construct_R(packB, SquareTopo);
+  auto RinvA = AlgType::construct_Rinv(packA, SquareTopo); auto RinvB = AlgType::construct_Rinv(packB, SquareTopo);
+  double error[2] = {0,0}, scale[2] = {0,0};
+  for (U i=0; i<RA.num_elems(); i++){
+    error[0] = std::max(error[0], static_cast<double>(std::abs(ScalarType(RA.data()[i])-RB.data()[i]))); scale[0] = std::max(scale[0], std::abs(RA.data()[i]));
+    error[1] = std::max(error[1], static_cast<double>(std::abs(ScalarType(RinvA.data()[i])-RinvB.data()[i]))); scale[1] = std::max(scale[1], std::abs(RinvA.data()[i]));
+  }
+  MPI_Allreduce(MPI_IN_PLACE, error, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD); MPI_Allreduce(MPI_IN_PLACE, scale, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  bool pass = (error[0] <= tolerance*scale[0]) && (error[1] <= tolerance*scale[1]);
+  if (rank==0) printf("%-28s N=%ld R error %.3e Rinv error %.3e %s\n", name, num_rows, error[0]/scale[0], error[1]/scale[1], pass ? "PASS" : "FAIL");
+  return pass;
+}
+
+int main(int argc, char** argv){
+  using namespace cholesky; using namespace cholesky::policy::cholinv;
+  int rank,size,provided; MPI_Init_thread(&argc, &argv, MPI_THREAD_SINGLE, &provided);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank); MPI_Comm_size(MPI_COMM_WORLD, &size);
+  size_t rep_factor = std::nearbyint(std::ceil(pow(size,1./3.)));	// a cubic grid, e.g. 1 or 8 processes
+
+  bool pass = true;
+  for (int64_t num_rows : {64,96,128}){
+    for (int64_t bcMultiplier : {0,-1,1}){
+      for (bool complete_inv : {true,false}){
+        pass &= check<cholinv<Serialize,SaveIntermediates,ReplicateCommComp,matmult::summa,NoLookahead>>("RCC/summa",num_rows,bcMultiplier,complete_inv,rep_factor);
+        pass &= check<cholinv<Serialize,SaveIntermediates,ReplicateCommComp,matmult::summa,Lookahead>>("RCC/summa/lookahead",num_rows,bcMultiplier,complete_inv,rep_factor);
+        pass &= check<cholinv<NoSerialize,FlushIntermediates,ReplicateComp,matmult::summa,Lookahead>>("RC/summa/lookahead",num_rows,bcMultiplier,complete_inv,rep_factor);
+      }
+    }
+  }
+  // Sizes include base cases that are not a multiple of DistributeComp's panel width
+  for (int64_t num_rows : {64,96,128,160,192,200,300}){
+    for (int64_t bcMultiplier : {0,-1,1}){
+      for (bool complete_inv : {true,false}){
+        pass &= check<cholinv<Serialize,SaveIntermediates,DistributeComp,matmult::summa,NoLookahead>>("DC/summa",num_rows,bcMultiplier,complete_inv,rep_factor);
+        pass &= check<cholinv<Serialize,FlushIntermediates,DistributeComp,matmult::summa,Lookahead>>("DC/summa/lookahead",num_rows,bcMultiplier,complete_inv,rep_factor);
+        pass &= check<cholinv<Serialize,SaveIntermediates,NodeShared,matmult::summa,NoLookahead>>("NS/summa",num_rows,bcMultiplier,complete_inv,rep_factor);
+        pass &= check<cholinv<NoSerialize,FlushIntermediates,NodeShared,matmult::summa,Lookahead>>("NS/summa/lookahead",num_rows,bcMultiplier,complete_inv,rep_factor);
+      }
+    }
+  }
+  pass &= check_congruent<cholinv<Serialize,SaveIntermediates,ReplicateCommComp>>("RCC/congruent",128,rep_factor);
+  pass &= check_congruent<cholinv<Serialize,SaveIntermediates,DistributeComp>>("DC/congruent",128,rep_factor);
+  pass &= check_congruent<cholinv<Serialize,SaveIntermediates,NodeShared>>("NS/congruent",128,rep_factor);
+  for (int64_t num_rows : {64,128}){
+    pass &= check_scalar<cholinv<Serialize,SaveIntermediates,ReplicateCommComp>,float>("RCC/float",num_rows,1e-4,rep_factor);
+    pass &= check_scalar<cholinv<Serialize,SaveIntermediates,ReplicateCommComp>,std::complex<float>>("RCC/complex<float>",num_rows,1e-4,rep_factor);
+    pass &= check_scalar<cholinv<Serialize,SaveIntermediates,ReplicateCommComp>,std::complex<double>>("RCC/complex<double>",num_rows,1e-12,rep_factor);
+    pass &= check_scalar<cholinv<NoSerialize,FlushIntermediates,ReplicateComp>,float>("RC/float",num_rows,1e-4,rep_factor);
+    pass &= check_scalar<cholinv<NoSerialize,FlushIntermediates,ReplicateComp>,std::complex<double>>("RC/complex<double>",num_rows,1e-12,rep_factor);
+    pass &= check_scalar<cholinv<Serialize,FlushIntermediates,DistributeComp>,float>("DC/float",num_rows,1e-4,rep_factor);
+    pass &= check_scalar<cholinv<Serialize,FlushIntermediates,DistributeComp>,std::complex<double>>("DC/complex<double>",num_rows,1e-12,rep_factor);
+  }
+  MPI_Finalize();
+  return pass ? 0 : 1;
+}
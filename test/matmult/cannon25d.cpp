@@ -0,0 +1,40 @@
+/* Author: Edward Hutter */
+
+#include "../../src/alg/matmult/cannon25d/cannon25d.h"
+
+using namespace std;
+
+// Multiplies random operands by Cannon's shifts and by summa, and checks that the two agree.
+bool check_gemm(int64_t num_rows, int64_t num_columns, int64_t inner_dimension, double beta, size_t rep_factor){
+  using T = double; using U = int64_t;
+  int rank; MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  auto SquareTopo = topo::square(MPI_COMM_WORLD,rep_factor,0,0);
+  matrix<T,U,rect> A(inner_dimension,num_rows,SquareTopo.d,SquareTopo.d); A.distribute_random(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c);
+  matrix<T,U,rect> B(num_columns,inner_dimension,SquareTopo.d,SquareTopo.d); B.distribute_random(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c+1);
+  matrix<T,U,rect> C(num_columns,num_rows,SquareTopo.d,SquareTopo.d); C.distribute_random(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c+2);
+  auto reference = C;
+  blas::ArgPack_gemm<T> blasArgs(blas::Order::AblasColumnMajor, blas::Transpose::AblasNoTrans, blas::Transpose::AblasNoTrans, 1.5, beta);
+  matmult::cannon25d::invoke(A, B, C, SquareTopo, blasArgs);
+  matmult::summa::invoke(A, B, reference, SquareTopo, blasArgs);
+  double error = 0;
+  for (U i=0; i<C.num_elems(); i++){ error = std::max(error, std::abs(C.data()[i]-reference.data()[i])); }
+  MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  bool pass = (error < 1e-12);
+  if (rank==0) printf("%-28s M=%ld N=%ld K=%ld beta=%.1f c=%zu error %.3e %s\n", "cannon25d/gemm", num_rows, num_columns, inner_dimension, beta, rep_factor, error, pass ? "PASS" : "FAIL");
+  return pass;
+}
+
+int main(int argc, char** argv){
+  int rank,size,provided; MPI_Init_thread(&argc, &argv, MPI_THREAD_SINGLE, &provided);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank); MPI_Comm_size(MPI_COMM_WORLD, &size);
+  size_t rep_factor = std::nearbyint(std::ceil(pow(size,1./3.)));	// a cubic grid, e.g. 1 or 8 processes
+
+  bool pass = true;
+  for (double beta : {0.,1.}){
+    pass &= check_gemm(32,32,32,beta,rep_factor);
+    pass &= check_gemm(64,16,32,beta,rep_factor);
+    pass &= check_gemm(16,48,64,beta,rep_factor);
+  }
+  MPI_Finalize();
+  return pass ? 0 : 1;
+}
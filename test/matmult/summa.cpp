@@ -0,0 +1,79 @@
+/* Author: Edward Hutter */
+
+#include "../../src/alg/matmult/summa/summa.h"
+
+using namespace std;
+
+// Multiplies an upper-triangular A, allocated with AllocatorPolicy, by a random B. When the pool is polluted first,
+//   A's pad (into which summa unpacks only the upper triangle) is a recycled block full of stale values.
+template<typename AllocatorPolicy>
+matrix<double,int64_t,rect> multiply_triangular(int64_t num_rows, bool pollute, topo::square& SquareTopo){
+  using T = double; using U = int64_t;
+  int rank; MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  U localDimension = num_rows/SquareTopo.d;
+  if (pollute){
+    matrix<T,U,rect,OffloadEachGemm,AllocatorPolicy> stale(num_rows,num_rows,SquareTopo.d,SquareTopo.d);
+    std::fill(stale.data(),stale.data()+stale.num_elems(),T(1000)); std::fill(stale.scratch(),stale.scratch()+stale.num_elems(),T(1000)); std::fill(stale.pad(),stale.pad()+stale.num_elems(),T(1000));
+  }
+  matrix<T,U,rect> Ar(num_rows,num_rows,SquareTopo.d,SquareTopo.d); Ar.distribute_random(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c);
+  matrix<T,U,uppertri,OffloadEachGemm,AllocatorPolicy> A(num_rows,num_rows,SquareTopo.d,SquareTopo.d);
+  serialize<rect,uppertri>::invoke(Ar,A,0,localDimension,0,localDimension,0,localDimension,0,localDimension);
+  matrix<T,U,rect> B(num_rows,num_rows,SquareTopo.d,SquareTopo.d); B.distribute_random(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c+1);
+  matrix<T,U,rect> C(num_rows,num_rows,SquareTopo.d,SquareTopo.d); std::fill(C.data(),C.data()+C.num_elems(),T(0));
+  blas::ArgPack_gemm<T> blasArgs(blas::Order::AblasColumnMajor, blas::Transpose::AblasNoTrans, blas::Transpose::AblasNoTrans, 1., 0.);
+  matmult::summa::invoke(A, B, C, SquareTopo, blasArgs);
+  return C;
+}
+
+// Checks that a pooled triangular operand multiplies like a heap-allocated one, even from a recycled block.
+bool check_pool(int64_t num_rows, size_t rep_factor){
+  int rank; MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  auto SquareTopo = topo::square(MPI_COMM_WORLD,rep_factor,0,0);
+  auto reference = multiply_triangular<HeapAllocator>(num_rows,false,SquareTopo);
+  auto pooled = multiply_triangular<PoolAllocator>(num_rows,true,SquareTopo);
+  double error = 0;
+  for (int64_t i=0; i<reference.num_elems(); i++){ error = std::max(error, std::abs(reference.data()[i]-pooled.data()[i])); }
+  MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  PoolAllocator::_release();
+  bool pass = (error < 1e-12);
+  if (rank==0) printf("%-28s N=%ld error %.3e %s\n", "uppertri/pool", num_rows, error, pass ? "PASS" : "FAIL");
+  return pass;
+}
+
+// Multiplies random operands into a C of much larger magnitude over WirePolicy, and checks that the result differs from a native multiply
+//   by no more than the wire's rounding of A*B, i.e. that beta*C is applied in full precision rather than sent over the wire.
+template<typename WirePolicy>
+bool check_wire_beta(const char* name, int64_t num_rows, double tolerance, size_t rep_factor){
+  using T = double; using U = int64_t;
+  int rank; MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  auto SquareTopo = topo::square(MPI_COMM_WORLD,rep_factor,0,0);
+  matrix<T,U,rect> A(num_rows,num_rows,SquareTopo.d,SquareTopo.d); A.distribute_random(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c);
+  matrix<T,U,rect> B(num_rows,num_rows,SquareTopo.d,SquareTopo.d); B.distribute_random(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c+1);
+  matrix<T,U,rect> C(num_rows,num_rows,SquareTopo.d,SquareTopo.d); C.distribute_random(SquareTopo.x, SquareTopo.y, SquareTopo.d, SquareTopo.d, rank/SquareTopo.c+2);
+  for (U i=0; i<C.num_elems(); i++){ C.data()[i] = 1e6 + C.data()[i]; }
+  auto reference = C;
+  blas::ArgPack_gemm<T> blasArgs(blas::Order::AblasColumnMajor, blas::Transpose::AblasNoTrans, blas::Transpose::AblasNoTrans, 1., 3.);
+  matmult::summa::invoke<WirePolicy>(A, B, C, SquareTopo, blasArgs);
+  matmult::summa::invoke(A, B, reference, SquareTopo, blasArgs);
+  double error = 0;
+  for (U i=0; i<C.num_elems(); i++){ error = std::max(error, std::abs(C.data()[i]-reference.data()[i])/num_rows); }
+  MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  bool pass = (error < tolerance);
+  if (rank==0) printf("%-28s N=%ld error %.3e %s\n", name, num_rows, error, pass ? "PASS" : "FAIL");
+  return pass;
+}
+
+int main(int argc, char** argv){
+  int rank,size,provided; MPI_Init_thread(&argc, &argv, MPI_THREAD_SINGLE, &provided);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank); MPI_Comm_size(MPI_COMM_WORLD, &size);
+  size_t rep_factor = std::nearbyint(std::ceil(pow(size,1./3.)));	// a cubic grid, e.g. 1 or 8 processes
+
+  bool pass = true;
+  for (int64_t num_rows : {16,64}){
+    pass &= check_pool(num_rows,rep_factor);
+    pass &= check_wire_beta<matmult::policy::summa::FloatWire>("beta/FloatWire",num_rows,1e-6,rep_factor);
+    pass &= check_wire_beta<matmult::policy::summa::BFloat16Wire>("beta/BFloat16Wire",num_rows,1e-2,rep_factor);
+  }
+  MPI_Finalize();
+  return pass ? 0 : 1;
+}
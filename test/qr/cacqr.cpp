@@ -0,0 +1,68 @@
+/* Author: Edward Hutter */
+
+#include "../../src/alg/qr/cacqr/cacqr.h"
+#include "validate.h"
+
+using namespace std;
+
+// Factors a random tall-skinny matrix twice (the second factorization reuses the intermediates) and checks the residual and the orthogonality of Q on rank 0.
+template<typename AlgType, typename CholeskyType>
+bool check(const char* name, int64_t num_rows, int64_t num_columns, size_t rep_factor, size_t variant, bool complete_inv){
+  using T = double; using U = int64_t;
+  int rank; MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  auto RectTopo = topo::rect(MPI_COMM_WORLD,rep_factor,0,0);
+  matrix<T,U,rect> A(num_columns,num_rows,RectTopo.c,RectTopo.d);
+  A.distribute_random(RectTopo.x, RectTopo.y, RectTopo.c, RectTopo.d, rank/RectTopo.c);
+  typename CholeskyType::template info<T,U> ci_pack(complete_inv,1,0,'U');
+  typename AlgType::template info<T,U,CholeskyType> pack(variant,ci_pack);
+  AlgType::factor(A, pack, RectTopo); AlgType::factor(A, pack, RectTopo);
+  double error[2] = {std::abs(qr::validate<AlgType>::residual(A,pack,RectTopo)), std::abs(qr::validate<AlgType>::orthogonality(A,pack,RectTopo))};
+  MPI_Allreduce(MPI_IN_PLACE, error, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  bool pass = (error[0] < 1e-10) && (error[1] < 1e-10);
+  if (rank==0) printf("%-28s M=%ld N=%ld c=%zu variant=%zu inv=%d residual %.3e orthogonality %.3e %s\n", name, num_rows, num_columns, rep_factor, variant, static_cast<int>(complete_inv), error[0], error[1], pass ? "PASS" : "FAIL");
+  return pass;
+}
+
+// Factors twice on a c>1 grid, and checks that the second factorization reuses the square grid and cholinv's plan.
+template<typename AlgType, typename CholeskyType>
+bool check_reuse(const char* name, int64_t num_rows, int64_t num_columns, size_t rep_factor){
+  using T = double; using U = int64_t;
+  int rank; MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  auto RectTopo = topo::rect(MPI_COMM_WORLD,rep_factor,0,0);
+  matrix<T,U,rect> A(num_columns,num_rows,RectTopo.c,RectTopo.d);
+  A.distribute_random(RectTopo.x, RectTopo.y, RectTopo.c, RectTopo.d, rank/RectTopo.c);
+  typename CholeskyType::template info<T,U> ci_pack(true,1,0,'U');
+  typename AlgType::template info<T,U,CholeskyType> pack(2,ci_pack);
+  AlgType::factor(A, pack, RectTopo); auto square = pack.square.get();
+  AlgType::factor(A, pack, RectTopo);
+  bool reused = (square == pack.square.get()) && pack.cholesky_inverse_args.planned(num_columns, square->d, square->c, square->slice);
+  double error[2] = {std::abs(qr::validate<AlgType>::residual(A,pack,RectTopo)), std::abs(qr::validate<AlgType>::orthogonality(A,pack,RectTopo))};
+  MPI_Allreduce(MPI_IN_PLACE, error, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  bool pass = reused && (error[0] < 1e-10) && (error[1] < 1e-10);
+  if (rank==0) printf("%-28s M=%ld N=%ld c=%zu reused %d residual %.3e orthogonality %.3e %s\n", name, num_rows, num_columns, rep_factor, static_cast<int>(reused), error[0], error[1], pass ? "PASS" : "FAIL");
+  return pass;
+}
+
+int main(int argc, char** argv){
+  using namespace qr; using namespace qr::policy::cacqr;
+  using cholesky_type = cholesky::cholinv<cholesky::policy::cholinv::Serialize,cholesky::policy::cholinv::SaveIntermediates,cholesky::policy::cholinv::ReplicateCommComp>;
+  int rank,size,provided; MPI_Init_thread(&argc, &argv, MPI_THREAD_SINGLE, &provided);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank); MPI_Comm_size(MPI_COMM_WORLD, &size);
+  size_t rep_factor = std::nearbyint(std::ceil(pow(size,1./3.)));	// a cubic grid, e.g. 1 or 8 processes
+
+  // The first CholeskyQR iteration of MixedPrecision runs in float, so only the second (variant 2) is expected to reach double precision
+  bool pass = true;
+  for (int64_t num_columns : {16,32}){
+    for (bool complete_inv : {true,false}){
+      pass &= check<cacqr<Serialize,SaveIntermediates>,cholesky_type>("cacqr2",4*num_columns,num_columns,1,2,complete_inv);
+      pass &= check<cacqr<Serialize,SaveIntermediates,MixedPrecision>,cholesky_type>("cacqr2/mixed",4*num_columns,num_columns,1,2,complete_inv);
+      pass &= check<cacqr<NoSerialize,SaveIntermediates,MixedPrecision>,cholesky_type>("cacqr2/mixed/noserialize",4*num_columns,num_columns,1,2,complete_inv);
+      pass &= check<cacqr<Serialize,SaveIntermediates>,cholesky_type>("cacqr2",4*num_columns,num_columns,rep_factor,2,complete_inv);
+      pass &= check<cacqr<Serialize,SaveIntermediates,MixedPrecision>,cholesky_type>("cacqr2/mixed",4*num_columns,num_columns,rep_factor,2,complete_inv);
+      pass &= check<cacqr<NoSerialize,SaveIntermediates,MixedPrecision>,cholesky_type>("cacqr2/mixed/noserialize",4*num_columns,num_columns,rep_factor,2,complete_inv);
+    }
+  }
+  if (rep_factor > 1){ pass &= check_reuse<cacqr<Serialize,SaveIntermediates>,cholesky_type>("cacqr2/reuse",128,32,rep_factor); }
+  MPI_Finalize();
+  return pass ? 0 : 1;
+}